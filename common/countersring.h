@@ -0,0 +1,296 @@
+#ifndef __COUNTERS_RING__
+#define __COUNTERS_RING__
+
+#include <stdint.h>
+#include <string.h>
+#include <unistd.h>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+#include <atomic>
+#include <algorithm>
+#include <string>
+#include <vector>
+
+/*
+ * Reader doesn't depend on SAI headers, annotations are defined here
+ * when not already provided by sai.h.
+ */
+
+#ifndef _In_
+#define _In_
+#endif
+
+#ifndef _Out_
+#define _Out_
+#endif
+
+/*
+ * Memory mapped ring of counters samples, written by syncd counters thread
+ * (when enabled in profile) and read by local agents without redis.
+ *
+ * Header is installed next to sairedis.h (libsairedis-dev), reader is
+ * header only and needs no library.
+ *
+ * File layout:
+ *
+ *   counters_ring_header_t
+ *   int32_t counter_ids[max_counters]          at ids_offset
+ *   slot[slots]                                at slots_offset
+ *
+ * Each slot (slot_size bytes) contains:
+ *
+ *   counters_ring_slot_header_t
+ *   record[max_objects]                        record_size bytes each
+ *
+ * Each record is array of uint64_t: object VID followed by max_counters
+ * values in order of counter_ids, not supported counters are set to
+ * COUNTERS_RING_INVALID_VALUE.
+ *
+ * Sample N (starting from 1) is stored in slot (N - 1) % slots. Slot is
+ * protected by sequence lock, slot seq is 2N - 1 while sample N is written
+ * and 2N when it's complete. Header last_sequence is N of last complete
+ * sample.
+ */
+
+#define COUNTERS_RING_MAGIC         0x474e495253544e43ULL
+#define COUNTERS_RING_VERSION       1
+#define COUNTERS_RING_INVALID_VALUE (~0ULL)
+
+typedef struct _counters_ring_header_t
+{
+    // written last, after whole header is initialized
+    std::atomic<uint64_t> magic;
+
+    uint32_t version;
+    uint32_t slots;
+    uint32_t max_objects;
+    uint32_t max_counters;
+
+    uint64_t record_size;
+    uint64_t slot_size;
+    uint64_t ids_offset;
+    uint64_t slots_offset;
+
+    std::atomic<uint64_t> last_sequence;
+
+} counters_ring_header_t;
+
+typedef struct _counters_ring_slot_header_t
+{
+    std::atomic<uint64_t> seq;
+
+    // CLOCK_REALTIME
+    uint64_t timestamp_ns;
+
+    uint32_t object_count;
+    uint32_t reserved;
+
+} counters_ring_slot_header_t;
+
+static_assert(sizeof(std::atomic<uint64_t>) == sizeof(uint64_t), "atomic must have same layout as uint64_t");
+
+inline uint64_t counters_ring_record_size(
+        _In_ uint32_t max_counters)
+{
+    return (1 + (uint64_t)max_counters) * sizeof(uint64_t);
+}
+
+inline uint64_t counters_ring_slot_size(
+        _In_ uint32_t max_objects,
+        _In_ uint32_t max_counters)
+{
+    return sizeof(counters_ring_slot_header_t) + max_objects * counters_ring_record_size(max_counters);
+}
+
+inline uint64_t counters_ring_ids_offset()
+{
+    return sizeof(counters_ring_header_t);
+}
+
+inline uint64_t counters_ring_slots_offset(
+        _In_ uint32_t max_counters)
+{
+    // keep slots 64 bytes aligned
+    uint64_t offset = counters_ring_ids_offset() + max_counters * sizeof(int32_t);
+
+    return (offset + 63) & ~63ULL;
+}
+
+inline uint64_t counters_ring_file_size(
+        _In_ uint32_t slots,
+        _In_ uint32_t max_objects,
+        _In_ uint32_t max_counters)
+{
+    return counters_ring_slots_offset(max_counters) + slots * counters_ring_slot_size(max_objects, max_counters);
+}
+
+/*
+ * Single record of sample, copied out of ring.
+ */
+struct CountersRingRecord
+{
+    uint64_t objectId;
+
+    std::vector<uint64_t> counters;
+};
+
+struct CountersRingSample
+{
+    uint64_t sequence;
+
+    uint64_t timestampNs;
+
+    std::vector<CountersRingRecord> records;
+};
+
+/*
+ * Lock free reader of counters ring. Reader never blocks writer, if sample
+ * was overwritten while it was copied, read fails and reader can continue
+ * with newer sample.
+ */
+class CountersRingReader
+{
+    public:
+
+        CountersRingReader():
+            m_base(NULL),
+            m_size(0)
+        {
+        }
+
+        ~CountersRingReader()
+        {
+            close();
+        }
+
+        bool open(
+                _In_ const std::string &path)
+        {
+            close();
+
+            int fd = ::open(path.c_str(), O_RDONLY);
+
+            if (fd < 0)
+                return false;
+
+            struct stat st;
+
+            if (fstat(fd, &st) != 0 || (size_t)st.st_size < sizeof(counters_ring_header_t))
+            {
+                ::close(fd);
+                return false;
+            }
+
+            void *base = mmap(NULL, st.st_size, PROT_READ, MAP_SHARED, fd, 0);
+
+            ::close(fd);
+
+            if (base == MAP_FAILED)
+                return false;
+
+            m_base = (const uint8_t*)base;
+            m_size = st.st_size;
+
+            const counters_ring_header_t *h = header();
+
+            if (h->magic.load(std::memory_order_acquire) != COUNTERS_RING_MAGIC ||
+                    h->version != COUNTERS_RING_VERSION ||
+                    counters_ring_file_size(h->slots, h->max_objects, h->max_counters) > m_size)
+            {
+                close();
+                return false;
+            }
+
+            return true;
+        }
+
+        void close()
+        {
+            if (m_base)
+                munmap((void*)m_base, m_size);
+
+            m_base = NULL;
+            m_size = 0;
+        }
+
+        /*
+         * Returns sequence of last complete sample, 0 if there is none.
+         */
+        uint64_t lastSequence() const
+        {
+            return header()->last_sequence.load(std::memory_order_acquire);
+        }
+
+        /*
+         * Counter ids (like sai_port_stat_counter_t) in order of values
+         * in records.
+         */
+        std::vector<int32_t> counterIds() const
+        {
+            const counters_ring_header_t *h = header();
+
+            const int32_t *ids = (const int32_t*)(m_base + h->ids_offset);
+
+            return std::vector<int32_t>(ids, ids + h->max_counters);
+        }
+
+        /*
+         * Copies sample with given sequence. Returns false when sample is
+         * not written yet, was already overwritten or was overwritten during
+         * copy.
+         */
+        bool read(
+                _In_ uint64_t sequence,
+                _Out_ CountersRingSample &sample) const
+        {
+            const counters_ring_header_t *h = header();
+
+            if (sequence == 0)
+                return false;
+
+            const uint8_t *slot = m_base + h->slots_offset + ((sequence - 1) % h->slots) * h->slot_size;
+
+            const counters_ring_slot_header_t *sh = (const counters_ring_slot_header_t*)slot;
+
+            uint64_t expected = 2 * sequence;
+
+            if (sh->seq.load(std::memory_order_acquire) != expected)
+                return false;
+
+            uint32_t count = std::min(sh->object_count, h->max_objects);
+
+            sample.sequence = sequence;
+            sample.timestampNs = sh->timestamp_ns;
+            sample.records.resize(count);
+
+            for (uint32_t i = 0; i < count; i++)
+            {
+                const uint64_t *record = (const uint64_t*)(slot + sizeof(counters_ring_slot_header_t) + i * h->record_size);
+
+                sample.records[i].objectId = record[0];
+                sample.records[i].counters.assign(record + 1, record + 1 + h->max_counters);
+            }
+
+            std::atomic_thread_fence(std::memory_order_acquire);
+
+            return sh->seq.load(std::memory_order_relaxed) == expected;
+        }
+
+    private:
+
+        CountersRingReader(const CountersRingReader&);
+        CountersRingReader& operator=(const CountersRingReader&);
+
+        const counters_ring_header_t* header() const
+        {
+            return (const counters_ring_header_t*)m_base;
+        }
+
+        const uint8_t *m_base;
+
+        size_t m_size;
+};
+
+#endif // __COUNTERS_RING__
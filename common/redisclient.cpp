@@ -39,6 +39,77 @@ int64_t RedisClient::hdel(std::string key, std::string field)
     return r.getContext()->integer;
 }
 
+std::string RedisClient::formatCommandArgv(const std::vector<std::string> &args)
+{
+    std::vector<const char*> argv;
+    std::vector<size_t> argvlen;
+
+    argv.reserve(args.size());
+    argvlen.reserve(args.size());
+
+    for (const auto &arg: args)
+    {
+        argv.push_back(arg.c_str());
+        argvlen.push_back(arg.size());
+    }
+
+    char *temp;
+    int len = redisFormatCommandArgv(&temp, (int)args.size(), argv.data(), argvlen.data());
+
+    if (len < 0)
+        throw std::runtime_error("failed to format redis command");
+
+    std::string command(temp, len);
+    free(temp);
+
+    return command;
+}
+
+int64_t RedisClient::hdel(std::string key, const std::vector<std::string> &fields)
+{
+    if (fields.size() == 0)
+        return 0;
+
+    std::vector<std::string> args;
+
+    args.reserve(fields.size() + 2);
+
+    args.push_back("HDEL");
+    args.push_back(key);
+    args.insert(args.end(), fields.begin(), fields.end());
+
+    RedisReply r(m_db, formatCommandArgv(args), REDIS_REPLY_INTEGER, true);
+
+    if (r.getContext()->type != REDIS_REPLY_INTEGER)
+        throw std::runtime_error("HDEL operation failed");
+
+    return r.getContext()->integer;
+}
+
+void RedisClient::hmset(std::string key, std::unordered_map<std::string, std::string> map)
+{
+    if (map.size() == 0)
+        return;
+
+    std::vector<std::string> args;
+
+    args.reserve(2 * map.size() + 2);
+
+    args.push_back("HMSET");
+    args.push_back(key);
+
+    for (const auto &kv: map)
+    {
+        args.push_back(kv.first);
+        args.push_back(kv.second);
+    }
+
+    RedisReply r(m_db, formatCommandArgv(args), REDIS_REPLY_STATUS, true);
+
+    if (r.getContext()->type != REDIS_REPLY_STATUS)
+        throw std::runtime_error("HMSET operation failed");
+}
+
 void RedisClient::hset(std::string key, std::string field, std::string value)
 {
     char *temp;
@@ -111,6 +182,73 @@ std::vector<std::string> RedisClient::keys(std::string key)
     return list;
 }
 
+void RedisClient::scanKeys(
+        const std::string &pattern,
+        size_t count,
+        KeysCallback callback)
+{
+    std::string cursor = "0";
+
+    do
+    {
+        RedisPipeline pipeline(this);
+
+        auto handle = pipeline.scan(cursor, pattern, count);
+
+        pipeline.flush();
+
+        redisReply *reply = pipeline.getReply(handle);
+
+        if (reply->elements != 2 ||
+                reply->element[0]->type != REDIS_REPLY_STRING ||
+                reply->element[1]->type != REDIS_REPLY_ARRAY)
+            throw std::runtime_error("SCAN operation failed, unexpected reply");
+
+        cursor = std::string(reply->element[0]->str, reply->element[0]->len);
+
+        redisReply *array = reply->element[1];
+
+        std::vector<std::string> keys;
+
+        keys.reserve(array->elements);
+
+        for (size_t i = 0; i < array->elements; i++)
+            keys.push_back(std::string(array->element[i]->str, array->element[i]->len));
+
+        if (keys.size())
+            callback(keys);
+    }
+    while (cursor != "0");
+}
+
+void RedisClient::scanHashes(
+        const std::string &pattern,
+        size_t count,
+        HashCallback callback)
+{
+    scanKeys(pattern, count, [&](const std::vector<std::string> &keys) {
+
+        RedisPipeline pipeline(this);
+
+        for (const auto &key: keys)
+            pipeline.hgetall(key);
+
+        pipeline.flush();
+
+        // handles are consecutive starting from 0
+
+        for (size_t i = 0; i < keys.size(); i++)
+        {
+            auto hash = pipeline.getHash(i);
+
+            if (hash.size() == 0)
+                continue;
+
+            callback(keys[i], hash);
+        }
+    });
+}
+
 int64_t RedisClient::incr(std::string key)
 {
     char *temp;
@@ -127,6 +265,22 @@ int64_t RedisClient::incr(std::string key)
     return r.getContext()->integer;
 }
 
+int64_t RedisClient::incrby(std::string key, int64_t value)
+{
+    char *temp;
+    int len = redisFormatCommand(&temp, "INCRBY %s %lld", key.c_str(), (long long)value);
+
+    std::string incrby(temp, len);
+    free(temp);
+
+    RedisReply r(m_db, incrby, REDIS_REPLY_INTEGER, true);
+
+    if (r.getContext()->type != REDIS_REPLY_INTEGER)
+        throw std::runtime_error("INCRBY command failed");
+
+    return r.getContext()->integer;
+}
+
 int64_t RedisClient::decr(std::string key)
 {
     char *temp;
@@ -266,4 +420,213 @@ std::shared_ptr<std::string> RedisClient::blpop(std::string list, int timeout)
 
     throw std::runtime_error("GET failed, memory exception");
 }
+
+RedisPipeline::RedisPipeline(RedisClient *client):
+    m_db(client->m_db)
+{
+}
+
+RedisPipeline::~RedisPipeline()
+{
+    clearReplies();
+}
+
+void RedisPipeline::clearReplies()
+{
+    for (auto reply: m_replies)
+    {
+        if (reply)
+            freeReplyObject(reply);
+    }
+
+    m_replies.clear();
+}
+
+RedisPipeline::Handle RedisPipeline::push(const std::vector<std::string> &args, int expectedType)
+{
+    return pushFormatted(RedisClient::formatCommandArgv(args), expectedType);
+}
+
+RedisPipeline::Handle RedisPipeline::pushFormatted(const std::string &command, int expectedType)
+{
+    if (m_replies.size())
+    {
+        // pipeline is reused after flush
+        clearReplies();
+    }
+
+    m_buffer += command;
+    m_expectedTypes.push_back(expectedType);
+
+    return m_expectedTypes.size() - 1;
+}
+
+RedisPipeline::Handle RedisPipeline::del(const std::string &key)
+{
+    return push({ "DEL", key }, REDIS_REPLY_INTEGER);
+}
+
+RedisPipeline::Handle RedisPipeline::hdel(const std::string &key, const std::vector<std::string> &fields)
+{
+    std::vector<std::string> args = { "HDEL", key };
+
+    args.insert(args.end(), fields.begin(), fields.end());
+
+    return push(args, REDIS_REPLY_INTEGER);
+}
+
+RedisPipeline::Handle RedisPipeline::hset(const std::string &key, const std::string &field, const std::string &value)
+{
+    return push({ "HSET", key, field, value }, REDIS_REPLY_INTEGER);
+}
+
+RedisPipeline::Handle RedisPipeline::hmset(const std::string &key, const std::unordered_map<std::string, std::string> &map)
+{
+    std::vector<std::string> args = { "HMSET", key };
+
+    args.reserve(2 * map.size() + 2);
+
+    for (const auto &kv: map)
+    {
+        args.push_back(kv.first);
+        args.push_back(kv.second);
+    }
+
+    return push(args, REDIS_REPLY_STATUS);
+}
+
+RedisPipeline::Handle RedisPipeline::hget(const std::string &key, const std::string &field)
+{
+    // reply can be string or nil
+    return push({ "HGET", key, field }, REDIS_REPLY_STRING);
+}
+
+RedisPipeline::Handle RedisPipeline::hgetall(const std::string &key)
+{
+    return push({ "HGETALL", key }, REDIS_REPLY_ARRAY);
+}
+
+RedisPipeline::Handle RedisPipeline::incr(const std::string &key)
+{
+    return push({ "INCR", key }, REDIS_REPLY_INTEGER);
+}
+
+RedisPipeline::Handle RedisPipeline::scan(const std::string &cursor, const std::string &pattern, size_t count)
+{
+    return push({ "SCAN", cursor, "MATCH", pattern, "COUNT", std::to_string(count) }, REDIS_REPLY_ARRAY);
+}
+
+size_t RedisPipeline::size() const
+{
+    return m_expectedTypes.size();
+}
+
+void RedisPipeline::flush()
+{
+    clearReplies();
+
+    size_t count = m_expectedTypes.size();
+
+    if (count == 0)
+        return;
+
+    redisContext *ctx = m_db->getContext();
+
+    // all commands are appended to output buffer at once, and whole
+    // buffer is written to socket when first reply is requested
+
+    if (redisAppendFormattedCommand(ctx, m_buffer.data(), m_buffer.size()) != REDIS_OK)
+        throw std::runtime_error("failed to append commands to pipeline");
+
+    // clear keeps capacity, so reused pipeline don't allocate again
+
+    m_buffer.clear();
+
+    m_replies.resize(count, NULL);
+
+    std::string error;
+
+    for (size_t i = 0; i < count; i++)
+    {
+        redisReply *reply = NULL;
+
+        // all replies must be read, even after error, to keep connection in sync
+
+        if (redisGetReply(ctx, (void**)&reply) != REDIS_OK || reply == NULL)
+            throw std::runtime_error("pipeline failed to get reply, connection error");
+
+        m_replies[i] = reply;
+
+        int expected = m_expectedTypes[i];
+
+        bool ok = reply->type == expected ||
+            (expected == REDIS_REPLY_STRING && reply->type == REDIS_REPLY_NIL);
+
+        if (!ok && error.empty())
+        {
+            error = "pipeline command " + std::to_string(i) + " unexpected reply type " + std::to_string(reply->type);
+
+            if (reply->type == REDIS_REPLY_ERROR)
+                error += ": " + std::string(reply->str, reply->len);
+        }
+    }
+
+    m_expectedTypes.clear();
+
+    if (!error.empty())
+    {
+        SWSS_LOG_ERROR("%s", error.c_str());
+
+        throw std::runtime_error(error);
+    }
+}
+
+redisReply *RedisPipeline::getReply(Handle handle) const
+{
+    if (handle >= m_replies.size())
+        throw std::runtime_error("invalid pipeline handle, pipeline not flushed?");
+
+    return m_replies[handle];
+}
+
+int64_t RedisPipeline::getInteger(Handle handle) const
+{
+    redisReply *reply = getReply(handle);
+
+    if (reply->type != REDIS_REPLY_INTEGER)
+        throw std::runtime_error("pipeline reply is not integer");
+
+    return reply->integer;
+}
+
+std::shared_ptr<std::string> RedisPipeline::getString(Handle handle) const
+{
+    redisReply *reply = getReply(handle);
+
+    if (reply->type == REDIS_REPLY_NIL)
+        return std::shared_ptr<std::string>(NULL);
+
+    if (reply->type != REDIS_REPLY_STRING)
+        throw std::runtime_error("pipeline reply is not string");
+
+    return std::make_shared<std::string>(reply->str, reply->len);
+}
+
+std::unordered_map<std::string, std::string> RedisPipeline::getHash(Handle handle) const
+{
+    redisReply *reply = getReply(handle);
+
+    if (reply->type != REDIS_REPLY_ARRAY)
+        throw std::runtime_error("pipeline reply is not array");
+
+    std::unordered_map<std::string, std::string> map;
+
+    for (size_t i = 0; i + 1 < reply->elements; i += 2)
+    {
+        map[std::string(reply->element[i]->str, reply->element[i]->len)] =
+            std::string(reply->element[i + 1]->str, reply->element[i + 1]->len);
+    }
+
+    return map;
+}
 }
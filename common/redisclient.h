@@ -11,6 +11,7 @@
 #include <stdexcept>
 #include <system_error>
 #include <memory>
+#include <functional>
 
 #include "swss/dbconnector.h"
 #include "swss/redisreply.h"
@@ -18,22 +19,58 @@
 namespace swss
 {
 
+class RedisPipeline;
+
 class RedisClient
 {
     public:
 
+        typedef std::function<void(const std::vector<std::string> &keys)> KeysCallback;
+
+        typedef std::function<void(const std::string &key, const std::unordered_map<std::string, std::string> &hash)> HashCallback;
+
         RedisClient(swss::DBConnector *db);
 
         int64_t del(std::string key);
 
         int64_t hdel(std::string key, std::string field);
 
+        int64_t hdel(std::string key, const std::vector<std::string> &fields);
+
         std::unordered_map<std::string, std::string> hgetall(std::string key);
 
         std::vector<std::string> keys(std::string key);
 
         std::vector<std::string> hkeys(std::string key);
 
+        /*
+         * Iterates keys matching pattern using SCAN cursor, so redis is not
+         * blocked for the whole key space like with KEYS. Callback is called
+         * for each batch of keys returned by single SCAN.
+         *
+         * SCAN can return same key more than once, caller must handle
+         * duplicates.
+         */
+        void scanKeys(
+                const std::string &pattern,
+                size_t count,
+                KeysCallback callback);
+
+        /*
+         * Iterates hashes matching pattern. For each SCAN batch all HGETALL
+         * commands are sent in single pipeline, and callback is called for
+         * each key before next batch is requested, so only single batch is
+         * kept in memory. Keys removed in between SCAN and HGETALL are
+         * skipped.
+         *
+         * Same as scanKeys, callback can be called more than once for the
+         * same key.
+         */
+        void scanHashes(
+                const std::string &pattern,
+                size_t count,
+                HashCallback callback);
+
         void set(std::string key, std::string value);
 
         void hset(std::string key, std::string field, std::string value);
@@ -52,6 +89,8 @@ class RedisClient
 
         int64_t incr(std::string key);
 
+        int64_t incrby(std::string key, int64_t value);
+
         int64_t decr(std::string key);
 
         int64_t rpush(std::string list, std::string item);
@@ -59,9 +98,82 @@ class RedisClient
         std::shared_ptr<std::string> blpop(std::string list, int timeout);
 
     private:
+
+        friend class RedisPipeline;
+
+        static std::string formatCommandArgv(const std::vector<std::string> &args);
+
         swss::DBConnector *m_db;
 };
 
+/*
+ * Queues commands and sends them to redis in single write on flush, then
+ * reads all replies. Each queued command returns handle which can be used
+ * after flush to get typed reply of that command.
+ *
+ * Reply type of each command is checked during flush, and runtime_error is
+ * thrown on mismatch, same as RedisClient does for single commands.
+ */
+class RedisPipeline
+{
+    public:
+
+        typedef size_t Handle;
+
+        RedisPipeline(RedisClient *client);
+
+        ~RedisPipeline();
+
+        Handle del(const std::string &key);
+
+        Handle hdel(const std::string &key, const std::vector<std::string> &fields);
+
+        Handle hset(const std::string &key, const std::string &field, const std::string &value);
+
+        Handle hmset(const std::string &key, const std::unordered_map<std::string, std::string> &map);
+
+        Handle hget(const std::string &key, const std::string &field);
+
+        Handle hgetall(const std::string &key);
+
+        Handle incr(const std::string &key);
+
+        Handle scan(const std::string &cursor, const std::string &pattern, size_t count);
+
+        Handle push(const std::vector<std::string> &args, int expectedType);
+
+        /*
+         * Queues command already formatted in redis protocol, for callers
+         * which format commands into reused buffers.
+         */
+        Handle pushFormatted(const std::string &command, int expectedType);
+
+        size_t size() const;
+
+        void flush();
+
+        int64_t getInteger(Handle handle) const;
+
+        std::shared_ptr<std::string> getString(Handle handle) const;
+
+        std::unordered_map<std::string, std::string> getHash(Handle handle) const;
+
+        redisReply *getReply(Handle handle) const;
+
+    private:
+
+        RedisPipeline(const RedisPipeline&);
+        RedisPipeline& operator=(const RedisPipeline&);
+
+        void clearReplies();
+
+        swss::DBConnector *m_db;
+
+        std::string m_buffer;
+        std::vector<int> m_expectedTypes;
+        std::vector<redisReply*> m_replies;
+};
+
 }
 
 #endif // __REDISCLIENT_H__
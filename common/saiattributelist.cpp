@@ -1,5 +1,18 @@
 #include "saiattributelist.h"
 
+bool g_compactEncoding = false;
+
+void SaiAttributeList::set_compact_encoding(
+        _In_ bool enable)
+{
+    g_compactEncoding = enable;
+}
+
+bool SaiAttributeList::get_compact_encoding()
+{
+    return g_compactEncoding;
+}
+
 SaiAttributeList::SaiAttributeList(
         _In_ const sai_object_type_t object_type,
         _In_ const std::vector<swss::FieldValueTuple> &values,
@@ -10,11 +23,23 @@ SaiAttributeList::SaiAttributeList(
     for (uint32_t i = 0; i < attr_count; ++i)
     {
         const std::string &str_attr_id = fvField(values[i]);
-        const std::string &str_attr_value = fvValue(values[i]);
+        const std::string &value = fvValue(values[i]);
 
         if (str_attr_id == "NULL")
             continue;
 
+        std::string hex_attr_value;
+
+        if (sai_is_compact_value(value))
+        {
+            if (!sai_deserialize_compact_value(value, hex_attr_value))
+            {
+                throw std::runtime_error("failed to decode compact attribute value");
+            }
+        }
+
+        const std::string &str_attr_value = sai_is_compact_value(value) ? hex_attr_value : value;
+
         sai_attribute_t attr;
         memset(&attr, 0, sizeof(sai_attribute_t));
 
@@ -103,6 +128,17 @@ std::vector<swss::FieldValueTuple> SaiAttributeList::serialize_attr_list(
             throw std::runtime_error("unable to serialize attribute value");
         }
 
+        if (g_compactEncoding)
+        {
+            std::string str_compact_value;
+
+            sai_serialize_compact_value(str_attr_value, str_compact_value);
+
+            // hex stays when compact is not shorter, both are accepted
+            if (str_compact_value.size() < str_attr_value.size())
+                str_attr_value = str_compact_value;
+        }
+
         swss::FieldValueTuple fvt(str_attr_id, str_attr_value);
 
         entry.push_back(fvt);
@@ -111,6 +147,51 @@ std::vector<swss::FieldValueTuple> SaiAttributeList::serialize_attr_list(
     return std::move(entry);
 }
 
+std::string SaiAttributeList::serialize_bulk_attr_list(
+        _In_ const std::vector<swss::FieldValueTuple> &values)
+{
+    std::string str;
+
+    for (const auto &fvt: values)
+    {
+        if (str.size())
+            str += '|';
+
+        str += fvField(fvt);
+        str += '=';
+        str += fvValue(fvt);
+    }
+
+    return str;
+}
+
+std::vector<swss::FieldValueTuple> SaiAttributeList::deserialize_bulk_attr_list(
+        _In_ const std::string &str)
+{
+    std::vector<swss::FieldValueTuple> values;
+
+    size_t start = 0;
+
+    while (start < str.size())
+    {
+        size_t end = str.find('|', start);
+
+        if (end == std::string::npos)
+            end = str.size();
+
+        size_t eq = str.find('=', start);
+
+        if (eq == std::string::npos || eq > end)
+            throw std::runtime_error("invalid bulk attribute: " + str.substr(start, end - start));
+
+        values.push_back(swss::FieldValueTuple(str.substr(start, eq - start), str.substr(eq + 1, end - eq - 1)));
+
+        start = end + 1;
+    }
+
+    return values;
+}
+
 sai_attribute_t* SaiAttributeList::get_attr_list()
 {
     return m_attr_list.data();
@@ -12,6 +12,14 @@
 #include "saiserialize.h"
 #include "string.h"
 
+/*
+ * Field in syncd HIDDEN hash with space separated list of attribute
+ * value encodings that syncd is able to decode.
+ */
+#define ATTR_ENCODINGS_FIELD        "ATTR_ENCODINGS"
+#define ATTR_ENCODING_HEX           "hex"
+#define ATTR_ENCODING_COMPACT_V1    "compact_v1"
+
 class SaiAttributeList
 {
     public:
@@ -33,6 +41,27 @@ class SaiAttributeList
                 _In_ const sai_attribute_t *attr_list,
                 _In_ bool onlyCount);
 
+        /*
+         * Bulk operations carry attributes of single object in one string
+         * "id=value|id=value", '|' is never produced by hex or compact
+         * encoding, and attribute id is hex, so first '=' ends id.
+         */
+        static std::string serialize_bulk_attr_list(
+                _In_ const std::vector<swss::FieldValueTuple> &values);
+
+        static std::vector<swss::FieldValueTuple> deserialize_bulk_attr_list(
+                _In_ const std::string &str);
+
+        /*
+         * When enabled, serialize_attr_list produces compact values
+         * where they are shorter than hex. Both forms are always
+         * accepted on input.
+         */
+        static void set_compact_encoding(
+                _In_ bool enable);
+
+        static bool get_compact_encoding();
+
     private:
 
         SaiAttributeList(const SaiAttributeList&);
@@ -1,149 +1,149 @@
 #include "saiserialize.h"
 
 #include <vector>
+#include <unordered_map>
+#include <algorithm>
 
-sai_serialization_map_t g_serialization_map = sai_get_serialization_map();
 sai_object_type_to_string_map_t g_object_type_map = sai_get_object_type_map();
 
-sai_serialization_map_t sai_get_serialization_map()
+/*
+ * Serialization type for each known attribute, this array is constant
+ * initialized, so it costs nothing at startup. Lookups go through index
+ * built from it on first use.
+ */
+static const sai_serialization_entry_t g_serialization_entries[] =
 {
-    SWSS_LOG_ENTER();
-
-    sai_serialization_map_t map;
-
-    map[SAI_OBJECT_TYPE_BUFFER_POOL][SAI_BUFFER_POOL_ATTR_SHARED_SIZE] = SAI_SERIALIZATION_TYPE_UINT32;
-    map[SAI_OBJECT_TYPE_BUFFER_POOL][SAI_BUFFER_POOL_ATTR_TYPE] = SAI_SERIALIZATION_TYPE_INT32;
-    map[SAI_OBJECT_TYPE_BUFFER_POOL][SAI_BUFFER_POOL_ATTR_SIZE] = SAI_SERIALIZATION_TYPE_UINT32;
-    map[SAI_OBJECT_TYPE_BUFFER_POOL][SAI_BUFFER_POOL_ATTR_TH_MODE] = SAI_SERIALIZATION_TYPE_INT32;
-
-    map[SAI_OBJECT_TYPE_BUFFER_PROFILE][SAI_BUFFER_PROFILE_ATTR_POOL_ID] = SAI_SERIALIZATION_TYPE_OBJECT_ID;
-    map[SAI_OBJECT_TYPE_BUFFER_PROFILE][SAI_BUFFER_PROFILE_ATTR_BUFFER_SIZE] = SAI_SERIALIZATION_TYPE_UINT32;
-    map[SAI_OBJECT_TYPE_BUFFER_PROFILE][SAI_BUFFER_PROFILE_ATTR_SHARED_DYNAMIC_TH] = SAI_SERIALIZATION_TYPE_INT8;
-    map[SAI_OBJECT_TYPE_BUFFER_PROFILE][SAI_BUFFER_PROFILE_ATTR_SHARED_STATIC_TH] = SAI_SERIALIZATION_TYPE_UINT32;
-    map[SAI_OBJECT_TYPE_BUFFER_PROFILE][SAI_BUFFER_PROFILE_ATTR_XOFF_TH] = SAI_SERIALIZATION_TYPE_UINT32;
-    map[SAI_OBJECT_TYPE_BUFFER_PROFILE][SAI_BUFFER_PROFILE_ATTR_XON_TH] = SAI_SERIALIZATION_TYPE_UINT32;
-
-    map[SAI_OBJECT_TYPE_ACL_TABLE][SAI_ACL_TABLE_ATTR_PRIORITY] = SAI_SERIALIZATION_TYPE_UINT32;
-
-    map[SAI_OBJECT_TYPE_QOS_MAPS][SAI_QOS_MAP_ATTR_TYPE] = SAI_SERIALIZATION_TYPE_INT32;
-    map[SAI_OBJECT_TYPE_QOS_MAPS][SAI_QOS_MAP_ATTR_MAP_TO_VALUE_LIST] = SAI_SERIALIZATION_TYPE_QOS_MAP_LIST;
-
-    map[SAI_OBJECT_TYPE_WRED][SAI_WRED_ATTR_GREEN_ENABLE] = SAI_SERIALIZATION_TYPE_BOOL;
-    map[SAI_OBJECT_TYPE_WRED][SAI_WRED_ATTR_GREEN_MIN_THRESHOLD] = SAI_SERIALIZATION_TYPE_UINT32;    
-    map[SAI_OBJECT_TYPE_WRED][SAI_WRED_ATTR_GREEN_MAX_THRESHOLD] = SAI_SERIALIZATION_TYPE_UINT32;
-    map[SAI_OBJECT_TYPE_WRED][SAI_WRED_ATTR_GREEN_DROP_PROBABILITY] = SAI_SERIALIZATION_TYPE_UINT32;
-    map[SAI_OBJECT_TYPE_WRED][SAI_WRED_ATTR_YELLOW_ENABLE] = SAI_SERIALIZATION_TYPE_BOOL;
-    map[SAI_OBJECT_TYPE_WRED][SAI_WRED_ATTR_YELLOW_MIN_THRESHOLD] = SAI_SERIALIZATION_TYPE_UINT32;
-    map[SAI_OBJECT_TYPE_WRED][SAI_WRED_ATTR_YELLOW_MAX_THRESHOLD] = SAI_SERIALIZATION_TYPE_UINT32;
-    map[SAI_OBJECT_TYPE_WRED][SAI_WRED_ATTR_YELLOW_DROP_PROBABILITY] = SAI_SERIALIZATION_TYPE_UINT32;
-    map[SAI_OBJECT_TYPE_WRED][SAI_WRED_ATTR_RED_ENABLE] = SAI_SERIALIZATION_TYPE_BOOL;
-    map[SAI_OBJECT_TYPE_WRED][SAI_WRED_ATTR_RED_MIN_THRESHOLD] = SAI_SERIALIZATION_TYPE_UINT32;
-    map[SAI_OBJECT_TYPE_WRED][SAI_WRED_ATTR_RED_MAX_THRESHOLD] = SAI_SERIALIZATION_TYPE_UINT32;
-    map[SAI_OBJECT_TYPE_WRED][SAI_WRED_ATTR_RED_DROP_PROBABILITY] = SAI_SERIALIZATION_TYPE_UINT32;
-    map[SAI_OBJECT_TYPE_WRED][SAI_WRED_ATTR_WEIGHT] = SAI_SERIALIZATION_TYPE_UINT8;    
-    map[SAI_OBJECT_TYPE_WRED][SAI_WRED_ATTR_ECN_MARK_ENABLE] = SAI_SERIALIZATION_TYPE_BOOL;
-
-    map[SAI_OBJECT_TYPE_PORT][SAI_PORT_ATTR_SPEED] = SAI_SERIALIZATION_TYPE_UINT32;
-    map[SAI_OBJECT_TYPE_PORT][SAI_PORT_ATTR_ADMIN_STATE] = SAI_SERIALIZATION_TYPE_BOOL;
-    map[SAI_OBJECT_TYPE_PORT][SAI_PORT_ATTR_OPER_STATUS] = SAI_SERIALIZATION_TYPE_INT32;
-    map[SAI_OBJECT_TYPE_PORT][SAI_PORT_ATTR_PORT_VLAN_ID] = SAI_SERIALIZATION_TYPE_UINT16;
-    map[SAI_OBJECT_TYPE_PORT][SAI_PORT_ATTR_FDB_LEARNING] = SAI_SERIALIZATION_TYPE_INT32;
-    map[SAI_OBJECT_TYPE_PORT][SAI_PORT_ATTR_HW_LANE_LIST] = SAI_SERIALIZATION_TYPE_UINT32_LIST;
-    map[SAI_OBJECT_TYPE_PORT][SAI_PORT_ATTR_QOS_DSCP_TO_TC_MAP] = SAI_SERIALIZATION_TYPE_OBJECT_ID;
-    map[SAI_OBJECT_TYPE_PORT][SAI_PORT_ATTR_QOS_TC_TO_QUEUE_MAP] = SAI_SERIALIZATION_TYPE_OBJECT_ID;
-    map[SAI_OBJECT_TYPE_PORT][SAI_PORT_ATTR_QOS_TC_TO_PRIORITY_GROUP_MAP] = SAI_SERIALIZATION_TYPE_OBJECT_ID;
-    map[SAI_OBJECT_TYPE_PORT][SAI_PORT_ATTR_QOS_INGRESS_BUFFER_PROFILE_LIST] = SAI_SERIALIZATION_TYPE_OBJECT_LIST;
-    map[SAI_OBJECT_TYPE_PORT][SAI_PORT_ATTR_QOS_EGRESS_BUFFER_PROFILE_LIST] = SAI_SERIALIZATION_TYPE_OBJECT_LIST;
-    map[SAI_OBJECT_TYPE_PORT][SAI_PORT_ATTR_NUMBER_OF_PRIORITY_GROUPS] = SAI_SERIALIZATION_TYPE_UINT32;
-    map[SAI_OBJECT_TYPE_PORT][SAI_PORT_ATTR_PRIORITY_GROUP_LIST] = SAI_SERIALIZATION_TYPE_OBJECT_LIST;    
-    map[SAI_OBJECT_TYPE_PORT][SAI_PORT_ATTR_QOS_NUMBER_OF_QUEUES] = SAI_SERIALIZATION_TYPE_UINT32;    
-    map[SAI_OBJECT_TYPE_PORT][SAI_PORT_ATTR_QOS_QUEUE_LIST] = SAI_SERIALIZATION_TYPE_OBJECT_LIST;
-    map[SAI_OBJECT_TYPE_PORT][SAI_PORT_ATTR_QOS_NUMBER_OF_SCHEDULER_GROUPS] = SAI_SERIALIZATION_TYPE_UINT32;
-    map[SAI_OBJECT_TYPE_PORT][SAI_PORT_ATTR_QOS_SCHEDULER_GROUP_LIST] = SAI_SERIALIZATION_TYPE_OBJECT_LIST;
-
-    map[SAI_OBJECT_TYPE_SCHEDULER][SAI_SCHEDULER_ATTR_SCHEDULING_ALGORITHM] = SAI_SERIALIZATION_TYPE_UINT32;
-    map[SAI_OBJECT_TYPE_SCHEDULER][SAI_SCHEDULER_ATTR_SCHEDULING_WEIGHT] = SAI_SERIALIZATION_TYPE_UINT8;
-    map[SAI_OBJECT_TYPE_SCHEDULER][SAI_SCHEDULER_ATTR_SHAPER_TYPE] = SAI_SERIALIZATION_TYPE_UINT32;
-    map[SAI_OBJECT_TYPE_SCHEDULER][SAI_SCHEDULER_ATTR_MIN_BANDWIDTH_RATE] = SAI_SERIALIZATION_TYPE_UINT64;
-    map[SAI_OBJECT_TYPE_SCHEDULER][SAI_SCHEDULER_ATTR_MIN_BANDWIDTH_BURST_RATE] = SAI_SERIALIZATION_TYPE_UINT64;
-    map[SAI_OBJECT_TYPE_SCHEDULER][SAI_SCHEDULER_ATTR_MAX_BANDWIDTH_RATE] = SAI_SERIALIZATION_TYPE_UINT64;
-    map[SAI_OBJECT_TYPE_SCHEDULER][SAI_SCHEDULER_ATTR_MAX_BANDWIDTH_BURST_RATE] = SAI_SERIALIZATION_TYPE_UINT64;
-        
-    map[SAI_OBJECT_TYPE_SCHEDULER_GROUP][SAI_SCHEDULER_GROUP_ATTR_CHILD_COUNT] = SAI_SERIALIZATION_TYPE_UINT32;
-    map[SAI_OBJECT_TYPE_SCHEDULER_GROUP][SAI_SCHEDULER_GROUP_ATTR_CHILD_LIST] = SAI_SERIALIZATION_TYPE_OBJECT_LIST;
-    map[SAI_OBJECT_TYPE_SCHEDULER_GROUP][SAI_SCHEDULER_GROUP_ATTR_SCHEDULER_PROFILE_ID] = SAI_SERIALIZATION_TYPE_OBJECT_ID;
-    
-    map[SAI_OBJECT_TYPE_PRIORITY_GROUP][SAI_INGRESS_PRIORITY_GROUP_ATTR_BUFFER_PROFILE] = SAI_SERIALIZATION_TYPE_OBJECT_ID;
-
-    map[SAI_OBJECT_TYPE_QUEUE][SAI_QUEUE_ATTR_WRED_PROFILE_ID] = SAI_SERIALIZATION_TYPE_OBJECT_ID;
-    map[SAI_OBJECT_TYPE_QUEUE][SAI_QUEUE_ATTR_BUFFER_PROFILE_ID] = SAI_SERIALIZATION_TYPE_OBJECT_ID;
-    map[SAI_OBJECT_TYPE_QUEUE][SAI_QUEUE_ATTR_SCHEDULER_PROFILE_ID] = SAI_SERIALIZATION_TYPE_OBJECT_ID;
-
-    map[SAI_OBJECT_TYPE_NEXT_HOP][SAI_NEXT_HOP_ATTR_TYPE] = SAI_SERIALIZATION_TYPE_INT32;
-    map[SAI_OBJECT_TYPE_NEXT_HOP][SAI_NEXT_HOP_ATTR_IP] = SAI_SERIALIZATION_TYPE_IP_ADDRESS;
-    map[SAI_OBJECT_TYPE_NEXT_HOP][SAI_NEXT_HOP_ATTR_ROUTER_INTERFACE_ID] = SAI_SERIALIZATION_TYPE_OBJECT_ID;
-
-    map[SAI_OBJECT_TYPE_NEXT_HOP_GROUP][SAI_NEXT_HOP_GROUP_ATTR_NEXT_HOP_COUNT] = SAI_SERIALIZATION_TYPE_UINT32;
-    map[SAI_OBJECT_TYPE_NEXT_HOP_GROUP][SAI_NEXT_HOP_GROUP_ATTR_TYPE] = SAI_SERIALIZATION_TYPE_INT32;
-    map[SAI_OBJECT_TYPE_NEXT_HOP_GROUP][SAI_NEXT_HOP_GROUP_ATTR_NEXT_HOP_LIST] = SAI_SERIALIZATION_TYPE_OBJECT_LIST;
-
-    map[SAI_OBJECT_TYPE_ROUTER_INTERFACE][SAI_ROUTER_INTERFACE_ATTR_VIRTUAL_ROUTER_ID] = SAI_SERIALIZATION_TYPE_OBJECT_ID;
-    map[SAI_OBJECT_TYPE_ROUTER_INTERFACE][SAI_ROUTER_INTERFACE_ATTR_TYPE] = SAI_SERIALIZATION_TYPE_INT32;
-    map[SAI_OBJECT_TYPE_ROUTER_INTERFACE][SAI_ROUTER_INTERFACE_ATTR_SRC_MAC_ADDRESS] = SAI_SERIALIZATION_TYPE_MAC;
-    map[SAI_OBJECT_TYPE_ROUTER_INTERFACE][SAI_ROUTER_INTERFACE_ATTR_VLAN_ID] = SAI_SERIALIZATION_TYPE_UINT16;
-    map[SAI_OBJECT_TYPE_ROUTER_INTERFACE][SAI_ROUTER_INTERFACE_ATTR_PORT_ID] = SAI_SERIALIZATION_TYPE_OBJECT_ID;
-
-    map[SAI_OBJECT_TYPE_HOST_INTERFACE][SAI_HOSTIF_ATTR_TYPE] = SAI_SERIALIZATION_TYPE_INT32;
-    map[SAI_OBJECT_TYPE_HOST_INTERFACE][SAI_HOSTIF_ATTR_RIF_OR_PORT_ID] = SAI_SERIALIZATION_TYPE_OBJECT_ID;
-    map[SAI_OBJECT_TYPE_HOST_INTERFACE][SAI_HOSTIF_ATTR_NAME] = SAI_SERIALIZATION_TYPE_CHARDATA;
-
-    map[SAI_OBJECT_TYPE_NEIGHBOR][SAI_NEIGHBOR_ATTR_DST_MAC_ADDRESS] = SAI_SERIALIZATION_TYPE_MAC;
-
-    map[SAI_OBJECT_TYPE_ROUTE][SAI_ROUTE_ATTR_PACKET_ACTION] = SAI_SERIALIZATION_TYPE_INT32;
-    map[SAI_OBJECT_TYPE_ROUTE][SAI_ROUTE_ATTR_TRAP_PRIORITY] = SAI_SERIALIZATION_TYPE_UINT8;
-    map[SAI_OBJECT_TYPE_ROUTE][SAI_ROUTE_ATTR_NEXT_HOP_ID] = SAI_SERIALIZATION_TYPE_OBJECT_ID;
-    map[SAI_OBJECT_TYPE_ROUTE][SAI_ROUTE_ATTR_META_DATA] = SAI_SERIALIZATION_TYPE_UINT32;
-
-    map[SAI_OBJECT_TYPE_SWITCH][SAI_SWITCH_ATTR_SWITCHING_MODE] = SAI_SERIALIZATION_TYPE_BOOL;
-    map[SAI_OBJECT_TYPE_SWITCH][SAI_SWITCH_ATTR_PORT_NUMBER] = SAI_SERIALIZATION_TYPE_UINT32;
-    map[SAI_OBJECT_TYPE_SWITCH][SAI_SWITCH_ATTR_PORT_LIST] = SAI_SERIALIZATION_TYPE_OBJECT_LIST;
-    map[SAI_OBJECT_TYPE_SWITCH][SAI_SWITCH_ATTR_PORT_MAX_MTU] = SAI_SERIALIZATION_TYPE_UINT32;
-    map[SAI_OBJECT_TYPE_SWITCH][SAI_SWITCH_ATTR_CPU_PORT] = SAI_SERIALIZATION_TYPE_OBJECT_ID;
-    map[SAI_OBJECT_TYPE_SWITCH][SAI_SWITCH_ATTR_SRC_MAC_ADDRESS] = SAI_SERIALIZATION_TYPE_MAC;
-    map[SAI_OBJECT_TYPE_SWITCH][SAI_SWITCH_ATTR_DEFAULT_VIRTUAL_ROUTER_ID] = SAI_SERIALIZATION_TYPE_OBJECT_ID;
-    map[SAI_OBJECT_TYPE_SWITCH][SAI_SWITCH_ATTR_EGRESS_BUFFER_POOL_NUM] = SAI_SERIALIZATION_TYPE_UINT32;
-    map[SAI_OBJECT_TYPE_SWITCH][SAI_SWITCH_ATTR_INGRESS_BUFFER_POOL_NUM] = SAI_SERIALIZATION_TYPE_UINT32;
-    map[SAI_OBJECT_TYPE_SWITCH][SAI_SWITCH_ATTR_QOS_MAX_NUMBER_OF_CHILDS_PER_SCHEDULER_GROUP] = SAI_SERIALIZATION_TYPE_INT32;        
-
-    map[SAI_OBJECT_TYPE_FDB][SAI_FDB_ENTRY_ATTR_TYPE] = SAI_SERIALIZATION_TYPE_INT32;
-    map[SAI_OBJECT_TYPE_FDB][SAI_FDB_ENTRY_ATTR_PORT_ID] = SAI_SERIALIZATION_TYPE_OBJECT_ID;
-
-    map[SAI_OBJECT_TYPE_VLAN][SAI_VLAN_ATTR_MAX_LEARNED_ADDRESSES] = SAI_SERIALIZATION_TYPE_UINT32;
-    map[SAI_OBJECT_TYPE_VLAN][SAI_VLAN_ATTR_MEMBER_LIST] = SAI_SERIALIZATION_TYPE_OBJECT_LIST;
-
-    map[SAI_OBJECT_TYPE_VLAN_MEMBER][SAI_VLAN_MEMBER_ATTR_VLAN_ID] = SAI_SERIALIZATION_TYPE_UINT16;
-    map[SAI_OBJECT_TYPE_VLAN_MEMBER][SAI_VLAN_MEMBER_ATTR_PORT_ID] = SAI_SERIALIZATION_TYPE_OBJECT_ID;
-
-    map[SAI_OBJECT_TYPE_TRAP][SAI_HOSTIF_TRAP_ATTR_PACKET_ACTION] = SAI_SERIALIZATION_TYPE_INT32;
-    map[SAI_OBJECT_TYPE_TRAP][SAI_HOSTIF_TRAP_ATTR_TRAP_CHANNEL] = SAI_SERIALIZATION_TYPE_INT32;
-    map[SAI_OBJECT_TYPE_TRAP][SAI_HOSTIF_TRAP_ATTR_TRAP_PRIORITY] = SAI_SERIALIZATION_TYPE_UINT32;
-
-    map[SAI_OBJECT_TYPE_LAG_MEMBER][SAI_LAG_MEMBER_ATTR_LAG_ID] = SAI_SERIALIZATION_TYPE_OBJECT_ID;
-    map[SAI_OBJECT_TYPE_LAG_MEMBER][SAI_LAG_MEMBER_ATTR_PORT_ID] = SAI_SERIALIZATION_TYPE_OBJECT_ID;
-
-    map[SAI_OBJECT_TYPE_TUNNEL][SAI_TUNNEL_ATTR_TYPE] = SAI_SERIALIZATION_TYPE_INT32;
-    map[SAI_OBJECT_TYPE_TUNNEL][SAI_TUNNEL_ATTR_DECAP_ECN_MODE] = SAI_SERIALIZATION_TYPE_INT32;
-    map[SAI_OBJECT_TYPE_TUNNEL][SAI_TUNNEL_ATTR_DECAP_TTL_MODE] = SAI_SERIALIZATION_TYPE_INT32;
-    map[SAI_OBJECT_TYPE_TUNNEL][SAI_TUNNEL_ATTR_DECAP_DSCP_MODE] = SAI_SERIALIZATION_TYPE_INT32;
-
-    map[SAI_OBJECT_TYPE_TUNNEL_TABLE_ENTRY][SAI_TUNNEL_TERM_TABLE_ENTRY_ATTR_VR_ID] = SAI_SERIALIZATION_TYPE_OBJECT_ID;
-    map[SAI_OBJECT_TYPE_TUNNEL_TABLE_ENTRY][SAI_TUNNEL_TERM_TABLE_ENTRY_ATTR_TYPE] = SAI_SERIALIZATION_TYPE_INT32;
-    map[SAI_OBJECT_TYPE_TUNNEL_TABLE_ENTRY][SAI_TUNNEL_TERM_TABLE_ENTRY_ATTR_DST_IP] = SAI_SERIALIZATION_TYPE_IP_ADDRESS;
-    map[SAI_OBJECT_TYPE_TUNNEL_TABLE_ENTRY][SAI_TUNNEL_TERM_TABLE_ENTRY_ATTR_TUNNEL_TYPE] = SAI_SERIALIZATION_TYPE_INT32;
-    map[SAI_OBJECT_TYPE_TUNNEL_TABLE_ENTRY][SAI_TUNNEL_TERM_TABLE_ENTRY_ATTR_ACTION_TUNNEL_ID] = SAI_SERIALIZATION_TYPE_OBJECT_ID;
-
-    return map;
-}
+    { SAI_OBJECT_TYPE_BUFFER_POOL, SAI_BUFFER_POOL_ATTR_SHARED_SIZE, SAI_SERIALIZATION_TYPE_UINT32 },
+    { SAI_OBJECT_TYPE_BUFFER_POOL, SAI_BUFFER_POOL_ATTR_TYPE, SAI_SERIALIZATION_TYPE_INT32 },
+    { SAI_OBJECT_TYPE_BUFFER_POOL, SAI_BUFFER_POOL_ATTR_SIZE, SAI_SERIALIZATION_TYPE_UINT32 },
+    { SAI_OBJECT_TYPE_BUFFER_POOL, SAI_BUFFER_POOL_ATTR_TH_MODE, SAI_SERIALIZATION_TYPE_INT32 },
+
+    { SAI_OBJECT_TYPE_BUFFER_PROFILE, SAI_BUFFER_PROFILE_ATTR_POOL_ID, SAI_SERIALIZATION_TYPE_OBJECT_ID },
+    { SAI_OBJECT_TYPE_BUFFER_PROFILE, SAI_BUFFER_PROFILE_ATTR_BUFFER_SIZE, SAI_SERIALIZATION_TYPE_UINT32 },
+    { SAI_OBJECT_TYPE_BUFFER_PROFILE, SAI_BUFFER_PROFILE_ATTR_SHARED_DYNAMIC_TH, SAI_SERIALIZATION_TYPE_INT8 },
+    { SAI_OBJECT_TYPE_BUFFER_PROFILE, SAI_BUFFER_PROFILE_ATTR_SHARED_STATIC_TH, SAI_SERIALIZATION_TYPE_UINT32 },
+    { SAI_OBJECT_TYPE_BUFFER_PROFILE, SAI_BUFFER_PROFILE_ATTR_XOFF_TH, SAI_SERIALIZATION_TYPE_UINT32 },
+    { SAI_OBJECT_TYPE_BUFFER_PROFILE, SAI_BUFFER_PROFILE_ATTR_XON_TH, SAI_SERIALIZATION_TYPE_UINT32 },
+
+    { SAI_OBJECT_TYPE_ACL_TABLE, SAI_ACL_TABLE_ATTR_PRIORITY, SAI_SERIALIZATION_TYPE_UINT32 },
+
+    { SAI_OBJECT_TYPE_QOS_MAPS, SAI_QOS_MAP_ATTR_TYPE, SAI_SERIALIZATION_TYPE_INT32 },
+    { SAI_OBJECT_TYPE_QOS_MAPS, SAI_QOS_MAP_ATTR_MAP_TO_VALUE_LIST, SAI_SERIALIZATION_TYPE_QOS_MAP_LIST },
+
+    { SAI_OBJECT_TYPE_WRED, SAI_WRED_ATTR_GREEN_ENABLE, SAI_SERIALIZATION_TYPE_BOOL },
+    { SAI_OBJECT_TYPE_WRED, SAI_WRED_ATTR_GREEN_MIN_THRESHOLD, SAI_SERIALIZATION_TYPE_UINT32 },
+    { SAI_OBJECT_TYPE_WRED, SAI_WRED_ATTR_GREEN_MAX_THRESHOLD, SAI_SERIALIZATION_TYPE_UINT32 },
+    { SAI_OBJECT_TYPE_WRED, SAI_WRED_ATTR_GREEN_DROP_PROBABILITY, SAI_SERIALIZATION_TYPE_UINT32 },
+    { SAI_OBJECT_TYPE_WRED, SAI_WRED_ATTR_YELLOW_ENABLE, SAI_SERIALIZATION_TYPE_BOOL },
+    { SAI_OBJECT_TYPE_WRED, SAI_WRED_ATTR_YELLOW_MIN_THRESHOLD, SAI_SERIALIZATION_TYPE_UINT32 },
+    { SAI_OBJECT_TYPE_WRED, SAI_WRED_ATTR_YELLOW_MAX_THRESHOLD, SAI_SERIALIZATION_TYPE_UINT32 },
+    { SAI_OBJECT_TYPE_WRED, SAI_WRED_ATTR_YELLOW_DROP_PROBABILITY, SAI_SERIALIZATION_TYPE_UINT32 },
+    { SAI_OBJECT_TYPE_WRED, SAI_WRED_ATTR_RED_ENABLE, SAI_SERIALIZATION_TYPE_BOOL },
+    { SAI_OBJECT_TYPE_WRED, SAI_WRED_ATTR_RED_MIN_THRESHOLD, SAI_SERIALIZATION_TYPE_UINT32 },
+    { SAI_OBJECT_TYPE_WRED, SAI_WRED_ATTR_RED_MAX_THRESHOLD, SAI_SERIALIZATION_TYPE_UINT32 },
+    { SAI_OBJECT_TYPE_WRED, SAI_WRED_ATTR_RED_DROP_PROBABILITY, SAI_SERIALIZATION_TYPE_UINT32 },
+    { SAI_OBJECT_TYPE_WRED, SAI_WRED_ATTR_WEIGHT, SAI_SERIALIZATION_TYPE_UINT8 },
+    { SAI_OBJECT_TYPE_WRED, SAI_WRED_ATTR_ECN_MARK_ENABLE, SAI_SERIALIZATION_TYPE_BOOL },
+
+    { SAI_OBJECT_TYPE_PORT, SAI_PORT_ATTR_SPEED, SAI_SERIALIZATION_TYPE_UINT32 },
+    { SAI_OBJECT_TYPE_PORT, SAI_PORT_ATTR_ADMIN_STATE, SAI_SERIALIZATION_TYPE_BOOL },
+    { SAI_OBJECT_TYPE_PORT, SAI_PORT_ATTR_OPER_STATUS, SAI_SERIALIZATION_TYPE_INT32 },
+    { SAI_OBJECT_TYPE_PORT, SAI_PORT_ATTR_PORT_VLAN_ID, SAI_SERIALIZATION_TYPE_UINT16 },
+    { SAI_OBJECT_TYPE_PORT, SAI_PORT_ATTR_FDB_LEARNING, SAI_SERIALIZATION_TYPE_INT32 },
+    { SAI_OBJECT_TYPE_PORT, SAI_PORT_ATTR_HW_LANE_LIST, SAI_SERIALIZATION_TYPE_UINT32_LIST },
+    { SAI_OBJECT_TYPE_PORT, SAI_PORT_ATTR_QOS_DSCP_TO_TC_MAP, SAI_SERIALIZATION_TYPE_OBJECT_ID },
+    { SAI_OBJECT_TYPE_PORT, SAI_PORT_ATTR_QOS_TC_TO_QUEUE_MAP, SAI_SERIALIZATION_TYPE_OBJECT_ID },
+    { SAI_OBJECT_TYPE_PORT, SAI_PORT_ATTR_QOS_TC_TO_PRIORITY_GROUP_MAP, SAI_SERIALIZATION_TYPE_OBJECT_ID },
+    { SAI_OBJECT_TYPE_PORT, SAI_PORT_ATTR_QOS_INGRESS_BUFFER_PROFILE_LIST, SAI_SERIALIZATION_TYPE_OBJECT_LIST },
+    { SAI_OBJECT_TYPE_PORT, SAI_PORT_ATTR_QOS_EGRESS_BUFFER_PROFILE_LIST, SAI_SERIALIZATION_TYPE_OBJECT_LIST },
+    { SAI_OBJECT_TYPE_PORT, SAI_PORT_ATTR_NUMBER_OF_PRIORITY_GROUPS, SAI_SERIALIZATION_TYPE_UINT32 },
+    { SAI_OBJECT_TYPE_PORT, SAI_PORT_ATTR_PRIORITY_GROUP_LIST, SAI_SERIALIZATION_TYPE_OBJECT_LIST },
+    { SAI_OBJECT_TYPE_PORT, SAI_PORT_ATTR_QOS_NUMBER_OF_QUEUES, SAI_SERIALIZATION_TYPE_UINT32 },
+    { SAI_OBJECT_TYPE_PORT, SAI_PORT_ATTR_QOS_QUEUE_LIST, SAI_SERIALIZATION_TYPE_OBJECT_LIST },
+    { SAI_OBJECT_TYPE_PORT, SAI_PORT_ATTR_QOS_NUMBER_OF_SCHEDULER_GROUPS, SAI_SERIALIZATION_TYPE_UINT32 },
+    { SAI_OBJECT_TYPE_PORT, SAI_PORT_ATTR_QOS_SCHEDULER_GROUP_LIST, SAI_SERIALIZATION_TYPE_OBJECT_LIST },
+
+    { SAI_OBJECT_TYPE_SCHEDULER, SAI_SCHEDULER_ATTR_SCHEDULING_ALGORITHM, SAI_SERIALIZATION_TYPE_UINT32 },
+    { SAI_OBJECT_TYPE_SCHEDULER, SAI_SCHEDULER_ATTR_SCHEDULING_WEIGHT, SAI_SERIALIZATION_TYPE_UINT8 },
+    { SAI_OBJECT_TYPE_SCHEDULER, SAI_SCHEDULER_ATTR_SHAPER_TYPE, SAI_SERIALIZATION_TYPE_UINT32 },
+    { SAI_OBJECT_TYPE_SCHEDULER, SAI_SCHEDULER_ATTR_MIN_BANDWIDTH_RATE, SAI_SERIALIZATION_TYPE_UINT64 },
+    { SAI_OBJECT_TYPE_SCHEDULER, SAI_SCHEDULER_ATTR_MIN_BANDWIDTH_BURST_RATE, SAI_SERIALIZATION_TYPE_UINT64 },
+    { SAI_OBJECT_TYPE_SCHEDULER, SAI_SCHEDULER_ATTR_MAX_BANDWIDTH_RATE, SAI_SERIALIZATION_TYPE_UINT64 },
+    { SAI_OBJECT_TYPE_SCHEDULER, SAI_SCHEDULER_ATTR_MAX_BANDWIDTH_BURST_RATE, SAI_SERIALIZATION_TYPE_UINT64 },
+
+    { SAI_OBJECT_TYPE_SCHEDULER_GROUP, SAI_SCHEDULER_GROUP_ATTR_CHILD_COUNT, SAI_SERIALIZATION_TYPE_UINT32 },
+    { SAI_OBJECT_TYPE_SCHEDULER_GROUP, SAI_SCHEDULER_GROUP_ATTR_CHILD_LIST, SAI_SERIALIZATION_TYPE_OBJECT_LIST },
+    { SAI_OBJECT_TYPE_SCHEDULER_GROUP, SAI_SCHEDULER_GROUP_ATTR_SCHEDULER_PROFILE_ID, SAI_SERIALIZATION_TYPE_OBJECT_ID },
+
+    { SAI_OBJECT_TYPE_PRIORITY_GROUP, SAI_INGRESS_PRIORITY_GROUP_ATTR_BUFFER_PROFILE, SAI_SERIALIZATION_TYPE_OBJECT_ID },
+
+    { SAI_OBJECT_TYPE_QUEUE, SAI_QUEUE_ATTR_WRED_PROFILE_ID, SAI_SERIALIZATION_TYPE_OBJECT_ID },
+    { SAI_OBJECT_TYPE_QUEUE, SAI_QUEUE_ATTR_BUFFER_PROFILE_ID, SAI_SERIALIZATION_TYPE_OBJECT_ID },
+    { SAI_OBJECT_TYPE_QUEUE, SAI_QUEUE_ATTR_SCHEDULER_PROFILE_ID, SAI_SERIALIZATION_TYPE_OBJECT_ID },
+
+    { SAI_OBJECT_TYPE_NEXT_HOP, SAI_NEXT_HOP_ATTR_TYPE, SAI_SERIALIZATION_TYPE_INT32 },
+    { SAI_OBJECT_TYPE_NEXT_HOP, SAI_NEXT_HOP_ATTR_IP, SAI_SERIALIZATION_TYPE_IP_ADDRESS },
+    { SAI_OBJECT_TYPE_NEXT_HOP, SAI_NEXT_HOP_ATTR_ROUTER_INTERFACE_ID, SAI_SERIALIZATION_TYPE_OBJECT_ID },
+
+    { SAI_OBJECT_TYPE_NEXT_HOP_GROUP, SAI_NEXT_HOP_GROUP_ATTR_NEXT_HOP_COUNT, SAI_SERIALIZATION_TYPE_UINT32 },
+    { SAI_OBJECT_TYPE_NEXT_HOP_GROUP, SAI_NEXT_HOP_GROUP_ATTR_TYPE, SAI_SERIALIZATION_TYPE_INT32 },
+    { SAI_OBJECT_TYPE_NEXT_HOP_GROUP, SAI_NEXT_HOP_GROUP_ATTR_NEXT_HOP_LIST, SAI_SERIALIZATION_TYPE_OBJECT_LIST },
+
+    { SAI_OBJECT_TYPE_ROUTER_INTERFACE, SAI_ROUTER_INTERFACE_ATTR_VIRTUAL_ROUTER_ID, SAI_SERIALIZATION_TYPE_OBJECT_ID },
+    { SAI_OBJECT_TYPE_ROUTER_INTERFACE, SAI_ROUTER_INTERFACE_ATTR_TYPE, SAI_SERIALIZATION_TYPE_INT32 },
+    { SAI_OBJECT_TYPE_ROUTER_INTERFACE, SAI_ROUTER_INTERFACE_ATTR_SRC_MAC_ADDRESS, SAI_SERIALIZATION_TYPE_MAC },
+    { SAI_OBJECT_TYPE_ROUTER_INTERFACE, SAI_ROUTER_INTERFACE_ATTR_VLAN_ID, SAI_SERIALIZATION_TYPE_UINT16 },
+    { SAI_OBJECT_TYPE_ROUTER_INTERFACE, SAI_ROUTER_INTERFACE_ATTR_PORT_ID, SAI_SERIALIZATION_TYPE_OBJECT_ID },
+
+    { SAI_OBJECT_TYPE_HOST_INTERFACE, SAI_HOSTIF_ATTR_TYPE, SAI_SERIALIZATION_TYPE_INT32 },
+    { SAI_OBJECT_TYPE_HOST_INTERFACE, SAI_HOSTIF_ATTR_RIF_OR_PORT_ID, SAI_SERIALIZATION_TYPE_OBJECT_ID },
+    { SAI_OBJECT_TYPE_HOST_INTERFACE, SAI_HOSTIF_ATTR_NAME, SAI_SERIALIZATION_TYPE_CHARDATA },
+
+    { SAI_OBJECT_TYPE_NEIGHBOR, SAI_NEIGHBOR_ATTR_DST_MAC_ADDRESS, SAI_SERIALIZATION_TYPE_MAC },
+
+    { SAI_OBJECT_TYPE_ROUTE, SAI_ROUTE_ATTR_PACKET_ACTION, SAI_SERIALIZATION_TYPE_INT32 },
+    { SAI_OBJECT_TYPE_ROUTE, SAI_ROUTE_ATTR_TRAP_PRIORITY, SAI_SERIALIZATION_TYPE_UINT8 },
+    { SAI_OBJECT_TYPE_ROUTE, SAI_ROUTE_ATTR_NEXT_HOP_ID, SAI_SERIALIZATION_TYPE_OBJECT_ID },
+    { SAI_OBJECT_TYPE_ROUTE, SAI_ROUTE_ATTR_META_DATA, SAI_SERIALIZATION_TYPE_UINT32 },
+
+    { SAI_OBJECT_TYPE_SWITCH, SAI_SWITCH_ATTR_SWITCHING_MODE, SAI_SERIALIZATION_TYPE_BOOL },
+    { SAI_OBJECT_TYPE_SWITCH, SAI_SWITCH_ATTR_PORT_NUMBER, SAI_SERIALIZATION_TYPE_UINT32 },
+    { SAI_OBJECT_TYPE_SWITCH, SAI_SWITCH_ATTR_PORT_LIST, SAI_SERIALIZATION_TYPE_OBJECT_LIST },
+    { SAI_OBJECT_TYPE_SWITCH, SAI_SWITCH_ATTR_PORT_MAX_MTU, SAI_SERIALIZATION_TYPE_UINT32 },
+    { SAI_OBJECT_TYPE_SWITCH, SAI_SWITCH_ATTR_CPU_PORT, SAI_SERIALIZATION_TYPE_OBJECT_ID },
+    { SAI_OBJECT_TYPE_SWITCH, SAI_SWITCH_ATTR_SRC_MAC_ADDRESS, SAI_SERIALIZATION_TYPE_MAC },
+    { SAI_OBJECT_TYPE_SWITCH, SAI_SWITCH_ATTR_DEFAULT_VIRTUAL_ROUTER_ID, SAI_SERIALIZATION_TYPE_OBJECT_ID },
+    { SAI_OBJECT_TYPE_SWITCH, SAI_SWITCH_ATTR_EGRESS_BUFFER_POOL_NUM, SAI_SERIALIZATION_TYPE_UINT32 },
+    { SAI_OBJECT_TYPE_SWITCH, SAI_SWITCH_ATTR_INGRESS_BUFFER_POOL_NUM, SAI_SERIALIZATION_TYPE_UINT32 },
+    { SAI_OBJECT_TYPE_SWITCH, SAI_SWITCH_ATTR_QOS_MAX_NUMBER_OF_CHILDS_PER_SCHEDULER_GROUP, SAI_SERIALIZATION_TYPE_INT32 },
+
+    { SAI_OBJECT_TYPE_FDB, SAI_FDB_ENTRY_ATTR_TYPE, SAI_SERIALIZATION_TYPE_INT32 },
+    { SAI_OBJECT_TYPE_FDB, SAI_FDB_ENTRY_ATTR_PORT_ID, SAI_SERIALIZATION_TYPE_OBJECT_ID },
+
+    { SAI_OBJECT_TYPE_VLAN, SAI_VLAN_ATTR_MAX_LEARNED_ADDRESSES, SAI_SERIALIZATION_TYPE_UINT32 },
+    { SAI_OBJECT_TYPE_VLAN, SAI_VLAN_ATTR_MEMBER_LIST, SAI_SERIALIZATION_TYPE_OBJECT_LIST },
+
+    { SAI_OBJECT_TYPE_VLAN_MEMBER, SAI_VLAN_MEMBER_ATTR_VLAN_ID, SAI_SERIALIZATION_TYPE_UINT16 },
+    { SAI_OBJECT_TYPE_VLAN_MEMBER, SAI_VLAN_MEMBER_ATTR_PORT_ID, SAI_SERIALIZATION_TYPE_OBJECT_ID },
+
+    { SAI_OBJECT_TYPE_TRAP, SAI_HOSTIF_TRAP_ATTR_PACKET_ACTION, SAI_SERIALIZATION_TYPE_INT32 },
+    { SAI_OBJECT_TYPE_TRAP, SAI_HOSTIF_TRAP_ATTR_TRAP_CHANNEL, SAI_SERIALIZATION_TYPE_INT32 },
+    { SAI_OBJECT_TYPE_TRAP, SAI_HOSTIF_TRAP_ATTR_TRAP_PRIORITY, SAI_SERIALIZATION_TYPE_UINT32 },
+
+    { SAI_OBJECT_TYPE_LAG_MEMBER, SAI_LAG_MEMBER_ATTR_LAG_ID, SAI_SERIALIZATION_TYPE_OBJECT_ID },
+    { SAI_OBJECT_TYPE_LAG_MEMBER, SAI_LAG_MEMBER_ATTR_PORT_ID, SAI_SERIALIZATION_TYPE_OBJECT_ID },
+
+    { SAI_OBJECT_TYPE_TUNNEL, SAI_TUNNEL_ATTR_TYPE, SAI_SERIALIZATION_TYPE_INT32 },
+    { SAI_OBJECT_TYPE_TUNNEL, SAI_TUNNEL_ATTR_DECAP_ECN_MODE, SAI_SERIALIZATION_TYPE_INT32 },
+    { SAI_OBJECT_TYPE_TUNNEL, SAI_TUNNEL_ATTR_DECAP_TTL_MODE, SAI_SERIALIZATION_TYPE_INT32 },
+    { SAI_OBJECT_TYPE_TUNNEL, SAI_TUNNEL_ATTR_DECAP_DSCP_MODE, SAI_SERIALIZATION_TYPE_INT32 },
+
+    { SAI_OBJECT_TYPE_TUNNEL_TABLE_ENTRY, SAI_TUNNEL_TERM_TABLE_ENTRY_ATTR_VR_ID, SAI_SERIALIZATION_TYPE_OBJECT_ID },
+    { SAI_OBJECT_TYPE_TUNNEL_TABLE_ENTRY, SAI_TUNNEL_TERM_TABLE_ENTRY_ATTR_TYPE, SAI_SERIALIZATION_TYPE_INT32 },
+    { SAI_OBJECT_TYPE_TUNNEL_TABLE_ENTRY, SAI_TUNNEL_TERM_TABLE_ENTRY_ATTR_DST_IP, SAI_SERIALIZATION_TYPE_IP_ADDRESS },
+    { SAI_OBJECT_TYPE_TUNNEL_TABLE_ENTRY, SAI_TUNNEL_TERM_TABLE_ENTRY_ATTR_TUNNEL_TYPE, SAI_SERIALIZATION_TYPE_INT32 },
+    { SAI_OBJECT_TYPE_TUNNEL_TABLE_ENTRY, SAI_TUNNEL_TERM_TABLE_ENTRY_ATTR_ACTION_TUNNEL_ID, SAI_SERIALIZATION_TYPE_OBJECT_ID },
+};
 
 sai_object_type_to_string_map_t sai_get_object_type_map()
 {
@@ -327,34 +327,473 @@ std::string sai_get_port_stat_counter_name(sai_port_stat_counter_t counter)
     return std::to_string(counter);
 }
 
+/*
+ * Attribute ids below this limit are kept in dense per object type
+ * arrays, ids above (like custom range attributes) go to sparse map.
+ * Limit covers ACL table and entry field and action ranges.
+ */
+#define SERIALIZATION_DENSE_ATTR_ID_LIMIT 0x4000
+
+#define SERIALIZATION_TYPE_UNKNOWN 0xff
+
+struct SerializationTypeIndex
+{
+    // for each object type, range in dense array, attribute id is offset
+
+    size_t offset[SAI_OBJECT_TYPE_MAX];
+    size_t size[SAI_OBJECT_TYPE_MAX];
+    bool known[SAI_OBJECT_TYPE_MAX];
+
+    std::vector<uint8_t> dense;
+
+    std::unordered_map<uint64_t, sai_attr_serialization_type_t> sparse;
+
+    static uint64_t sparseKey(
+            _In_ sai_object_type_t object_type,
+            _In_ sai_attr_id_t attr_id)
+    {
+        return ((uint64_t)object_type << 32) | (uint32_t)attr_id;
+    }
+
+    SerializationTypeIndex()
+    {
+        memset(size, 0, sizeof(size));
+        memset(known, 0, sizeof(known));
+
+        for (const auto &e: g_serialization_entries)
+        {
+            known[e.object_type] = true;
+
+            if (e.attr_id >= 0 && e.attr_id < SERIALIZATION_DENSE_ATTR_ID_LIMIT)
+                size[e.object_type] = std::max(size[e.object_type], (size_t)e.attr_id + 1);
+        }
+
+        size_t total = 0;
+
+        for (int ot = 0; ot < SAI_OBJECT_TYPE_MAX; ot++)
+        {
+            offset[ot] = total;
+            total += size[ot];
+        }
+
+        dense.assign(total, SERIALIZATION_TYPE_UNKNOWN);
+
+        // entries are applied in order, so later definition wins
+
+        for (const auto &e: g_serialization_entries)
+        {
+            if (e.attr_id >= 0 && e.attr_id < SERIALIZATION_DENSE_ATTR_ID_LIMIT)
+                dense[offset[e.object_type] + e.attr_id] = (uint8_t)e.serialization_type;
+            else
+                sparse[sparseKey(e.object_type, e.attr_id)] = e.serialization_type;
+        }
+    }
+};
+
 sai_status_t sai_get_serialization_type(
         _In_ const sai_object_type_t object_type,
         _In_ const sai_attr_id_t attr_id,
         _Out_ sai_attr_serialization_type_t &serialization_type)
 {
-    auto it = g_serialization_map.find(object_type);
+    static const SerializationTypeIndex index;
 
-    if (it == g_serialization_map.end())
+    if (object_type < 0 || object_type >= SAI_OBJECT_TYPE_MAX || !index.known[object_type])
     {
         SWSS_LOG_ERROR("serialization object not found %x", object_type);
 
         return SAI_STATUS_NOT_IMPLEMENTED;
     }
 
-    std::map<sai_attr_id_t, sai_attr_serialization_type_t> &map = it->second;
+    if (attr_id >= 0 && (size_t)attr_id < index.size[object_type])
+    {
+        uint8_t type = index.dense[index.offset[object_type] + attr_id];
 
-    auto mit = map.find(attr_id);
+        if (type != SERIALIZATION_TYPE_UNKNOWN)
+        {
+            serialization_type = (sai_attr_serialization_type_t)type;
 
-    if (mit == map.end())
+            return SAI_STATUS_SUCCESS;
+        }
+    }
+    else if (index.sparse.size())
     {
-        SWSS_LOG_ERROR("serialization attribute id not found %u for object type : %u", attr_id, object_type);
+        auto it = index.sparse.find(SerializationTypeIndex::sparseKey(object_type, attr_id));
 
-        return SAI_STATUS_NOT_IMPLEMENTED;
+        if (it != index.sparse.end())
+        {
+            serialization_type = it->second;
+
+            return SAI_STATUS_SUCCESS;
+        }
     }
 
-    serialization_type = mit->second;
+    SWSS_LOG_ERROR("serialization attribute id not found %u for object type : %u", attr_id, object_type);
 
-    return SAI_STATUS_SUCCESS;
+    return SAI_STATUS_NOT_IMPLEMENTED;
+}
+
+/*
+ * Hex codec used for all primitives and buffers that are put to redis.
+ *
+ * Encoding is always lower case and byte identical to what previous
+ * stringstream based implementation produced. Decoding accepts both lower
+ * and upper case digits and exits on invalid character, same as char_to_int.
+ *
+ * On x86 SSE2 and AVX2 paths are selected at runtime, scalar lookup table
+ * implementation is used for tails, short buffers and other architectures.
+ */
+
+static const char g_hexDigits[] = "0123456789abcdef";
+
+// value of hex digit for each character, -1 for invalid characters
+
+static const int8_t g_hexValues[256] =
+{
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     0,  1,  2,  3,  4,  5,  6,  7,  8,  9, -1, -1, -1, -1, -1, -1,
+    -1, 10, 11, 12, 13, 14, 15, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, 10, 11, 12, 13, 14, 15, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+};
+
+static void hex_encode_scalar(
+        _In_ const unsigned char *mem,
+        _In_ size_t size,
+        _Out_ char *out)
+{
+    for (size_t i = 0; i < size; i++)
+    {
+        out[2 * i] = g_hexDigits[mem[i] >> 4];
+        out[2 * i + 1] = g_hexDigits[mem[i] & 0xf];
+    }
+}
+
+static void hex_decode_scalar(
+        _In_ const char *ptr,
+        _In_ size_t size,
+        _Out_ unsigned char *mem)
+{
+    for (size_t i = 0; i < size; i++)
+    {
+        int u = g_hexValues[(unsigned char)ptr[2 * i]];
+        int l = g_hexValues[(unsigned char)ptr[2 * i + 1]];
+
+        if (u < 0 || l < 0)
+        {
+            // char_to_int will log invalid character and exit
+            u = char_to_int(ptr[2 * i]);
+            l = char_to_int(ptr[2 * i + 1]);
+        }
+
+        mem[i] = (unsigned char)((u << 4) | l);
+    }
+}
+
+typedef void (*hex_encode_fn)(const unsigned char *mem, size_t size, char *out);
+typedef void (*hex_decode_fn)(const char *ptr, size_t size, unsigned char *mem);
+
+#if defined(__x86_64__) || defined(__i386__)
+
+#include <immintrin.h>
+
+__attribute__((target("sse2")))
+static inline __m128i hex_nibbles_to_ascii_sse2(
+        _In_ __m128i nibbles)
+{
+    // '0' + n for 0..9 and 'a' + n - 10 for 10..15
+
+    __m128i letters = _mm_and_si128(
+            _mm_cmpgt_epi8(nibbles, _mm_set1_epi8(9)),
+            _mm_set1_epi8('a' - '0' - 10));
+
+    return _mm_add_epi8(_mm_add_epi8(nibbles, _mm_set1_epi8('0')), letters);
+}
+
+__attribute__((target("sse2")))
+static void hex_encode_sse2(
+        _In_ const unsigned char *mem,
+        _In_ size_t size,
+        _Out_ char *out)
+{
+    const __m128i mask = _mm_set1_epi8(0x0f);
+
+    size_t i = 0;
+
+    for (; i + 16 <= size; i += 16)
+    {
+        __m128i in = _mm_loadu_si128((const __m128i*)(mem + i));
+
+        __m128i hi = hex_nibbles_to_ascii_sse2(_mm_and_si128(_mm_srli_epi16(in, 4), mask));
+        __m128i lo = hex_nibbles_to_ascii_sse2(_mm_and_si128(in, mask));
+
+        _mm_storeu_si128((__m128i*)(out + 2 * i), _mm_unpacklo_epi8(hi, lo));
+        _mm_storeu_si128((__m128i*)(out + 2 * i + 16), _mm_unpackhi_epi8(hi, lo));
+    }
+
+    hex_encode_scalar(mem + i, size - i, out + 2 * i);
+}
+
+/*
+ * Converts 16 hex characters to nibble values, returns false if any of
+ * characters is not valid hex digit.
+ */
+__attribute__((target("sse2")))
+static inline bool hex_ascii_to_nibbles_sse2(
+        _In_ __m128i in,
+        _Out_ __m128i &nibbles)
+{
+    const __m128i zero = _mm_setzero_si128();
+
+    __m128i digit = _mm_sub_epi8(in, _mm_set1_epi8('0'));
+    __m128i alpha = _mm_sub_epi8(_mm_or_si128(in, _mm_set1_epi8(0x20)), _mm_set1_epi8('a'));
+
+    __m128i isDigit = _mm_andnot_si128(
+            _mm_or_si128(_mm_cmpgt_epi8(digit, _mm_set1_epi8(9)), _mm_cmplt_epi8(digit, zero)),
+            _mm_set1_epi8(-1));
+
+    __m128i isAlpha = _mm_andnot_si128(
+            _mm_or_si128(_mm_cmpgt_epi8(alpha, _mm_set1_epi8(5)), _mm_cmplt_epi8(alpha, zero)),
+            _mm_set1_epi8(-1));
+
+    if (_mm_movemask_epi8(_mm_or_si128(isDigit, isAlpha)) != 0xffff)
+        return false;
+
+    nibbles = _mm_or_si128(
+            _mm_and_si128(isDigit, digit),
+            _mm_and_si128(isAlpha, _mm_add_epi8(alpha, _mm_set1_epi8(10))));
+
+    return true;
+}
+
+__attribute__((target("sse2")))
+static inline __m128i hex_nibble_pairs_to_words_sse2(
+        _In_ __m128i nibbles)
+{
+    // each 16 bit word holds high nibble in low byte and low nibble in high byte
+
+    __m128i hi = _mm_and_si128(nibbles, _mm_set1_epi16(0x00ff));
+    __m128i lo = _mm_srli_epi16(nibbles, 8);
+
+    return _mm_or_si128(_mm_slli_epi16(hi, 4), lo);
+}
+
+__attribute__((target("sse2")))
+static void hex_decode_sse2(
+        _In_ const char *ptr,
+        _In_ size_t size,
+        _Out_ unsigned char *mem)
+{
+    size_t i = 0;
+
+    for (; i + 16 <= size; i += 16)
+    {
+        __m128i a;
+        __m128i b;
+
+        if (!hex_ascii_to_nibbles_sse2(_mm_loadu_si128((const __m128i*)(ptr + 2 * i)), a) ||
+            !hex_ascii_to_nibbles_sse2(_mm_loadu_si128((const __m128i*)(ptr + 2 * i + 16)), b))
+        {
+            break; // scalar path will report invalid character
+        }
+
+        __m128i out = _mm_packus_epi16(
+                hex_nibble_pairs_to_words_sse2(a),
+                hex_nibble_pairs_to_words_sse2(b));
+
+        _mm_storeu_si128((__m128i*)(mem + i), out);
+    }
+
+    hex_decode_scalar(ptr + 2 * i, size - i, mem + i);
+}
+
+__attribute__((target("avx2")))
+static inline __m256i hex_nibbles_to_ascii_avx2(
+        _In_ __m256i nibbles)
+{
+    __m256i letters = _mm256_and_si256(
+            _mm256_cmpgt_epi8(nibbles, _mm256_set1_epi8(9)),
+            _mm256_set1_epi8('a' - '0' - 10));
+
+    return _mm256_add_epi8(_mm256_add_epi8(nibbles, _mm256_set1_epi8('0')), letters);
+}
+
+__attribute__((target("avx2")))
+static void hex_encode_avx2(
+        _In_ const unsigned char *mem,
+        _In_ size_t size,
+        _Out_ char *out)
+{
+    const __m256i mask = _mm256_set1_epi8(0x0f);
+
+    size_t i = 0;
+
+    for (; i + 32 <= size; i += 32)
+    {
+        __m256i in = _mm256_loadu_si256((const __m256i*)(mem + i));
+
+        __m256i hi = hex_nibbles_to_ascii_avx2(_mm256_and_si256(_mm256_srli_epi16(in, 4), mask));
+        __m256i lo = hex_nibbles_to_ascii_avx2(_mm256_and_si256(in, mask));
+
+        // unpack works per 128 bit lane, so fix order across lanes
+
+        __m256i l = _mm256_unpacklo_epi8(hi, lo);
+        __m256i h = _mm256_unpackhi_epi8(hi, lo);
+
+        _mm256_storeu_si256((__m256i*)(out + 2 * i), _mm256_permute2x128_si256(l, h, 0x20));
+        _mm256_storeu_si256((__m256i*)(out + 2 * i + 32), _mm256_permute2x128_si256(l, h, 0x31));
+    }
+
+    hex_encode_sse2(mem + i, size - i, out + 2 * i);
+}
+
+__attribute__((target("avx2")))
+static inline bool hex_ascii_to_nibbles_avx2(
+        _In_ __m256i in,
+        _Out_ __m256i &nibbles)
+{
+    const __m256i zero = _mm256_setzero_si256();
+    const __m256i ones = _mm256_set1_epi8(-1);
+
+    __m256i digit = _mm256_sub_epi8(in, _mm256_set1_epi8('0'));
+    __m256i alpha = _mm256_sub_epi8(_mm256_or_si256(in, _mm256_set1_epi8(0x20)), _mm256_set1_epi8('a'));
+
+    __m256i isDigit = _mm256_andnot_si256(
+            _mm256_or_si256(_mm256_cmpgt_epi8(digit, _mm256_set1_epi8(9)), _mm256_cmpgt_epi8(zero, digit)),
+            ones);
+
+    __m256i isAlpha = _mm256_andnot_si256(
+            _mm256_or_si256(_mm256_cmpgt_epi8(alpha, _mm256_set1_epi8(5)), _mm256_cmpgt_epi8(zero, alpha)),
+            ones);
+
+    if (_mm256_movemask_epi8(_mm256_or_si256(isDigit, isAlpha)) != -1)
+        return false;
+
+    nibbles = _mm256_or_si256(
+            _mm256_and_si256(isDigit, digit),
+            _mm256_and_si256(isAlpha, _mm256_add_epi8(alpha, _mm256_set1_epi8(10))));
+
+    return true;
+}
+
+__attribute__((target("avx2")))
+static void hex_decode_avx2(
+        _In_ const char *ptr,
+        _In_ size_t size,
+        _Out_ unsigned char *mem)
+{
+    const __m256i lowByte = _mm256_set1_epi16(0x00ff);
+
+    size_t i = 0;
+
+    for (; i + 32 <= size; i += 32)
+    {
+        __m256i a;
+        __m256i b;
+
+        if (!hex_ascii_to_nibbles_avx2(_mm256_loadu_si256((const __m256i*)(ptr + 2 * i)), a) ||
+            !hex_ascii_to_nibbles_avx2(_mm256_loadu_si256((const __m256i*)(ptr + 2 * i + 32)), b))
+        {
+            break; // scalar path will report invalid character
+        }
+
+        a = _mm256_or_si256(_mm256_slli_epi16(_mm256_and_si256(a, lowByte), 4), _mm256_srli_epi16(a, 8));
+        b = _mm256_or_si256(_mm256_slli_epi16(_mm256_and_si256(b, lowByte), 4), _mm256_srli_epi16(b, 8));
+
+        // pack works per 128 bit lane, so fix order across lanes
+
+        __m256i out = _mm256_permute4x64_epi64(_mm256_packus_epi16(a, b), 0xd8);
+
+        _mm256_storeu_si256((__m256i*)(mem + i), out);
+    }
+
+    hex_decode_sse2(ptr + 2 * i, size - i, mem + i);
+}
+
+static hex_encode_fn hex_select_encode()
+{
+    __builtin_cpu_init();
+
+    if (__builtin_cpu_supports("avx2"))
+        return hex_encode_avx2;
+
+    if (__builtin_cpu_supports("sse2"))
+        return hex_encode_sse2;
+
+    return hex_encode_scalar;
+}
+
+static hex_decode_fn hex_select_decode()
+{
+    __builtin_cpu_init();
+
+    if (__builtin_cpu_supports("avx2"))
+        return hex_decode_avx2;
+
+    if (__builtin_cpu_supports("sse2"))
+        return hex_decode_sse2;
+
+    return hex_decode_scalar;
+}
+
+#else
+
+static hex_encode_fn hex_select_encode()
+{
+    return hex_encode_scalar;
+}
+
+static hex_decode_fn hex_select_decode()
+{
+    return hex_decode_scalar;
+}
+
+#endif
+
+// selected on first use, since serialization may be used during static init
+
+static void hex_encode(
+        _In_ const unsigned char *mem,
+        _In_ size_t size,
+        _Out_ char *out)
+{
+    // most primitives are short, don't bother with dispatch for them
+
+    if (size < 16)
+    {
+        hex_encode_scalar(mem, size, out);
+        return;
+    }
+
+    static const hex_encode_fn encode = hex_select_encode();
+
+    encode(mem, size, out);
+}
+
+static void hex_decode(
+        _In_ const char *ptr,
+        _In_ size_t size,
+        _Out_ unsigned char *mem)
+{
+    if (size < 16)
+    {
+        hex_decode_scalar(ptr, size, mem);
+        return;
+    }
+
+    static const hex_decode_fn decode = hex_select_decode();
+
+    decode(ptr, size, mem);
 }
 
 void sai_deserialize_buffer(
@@ -363,21 +802,15 @@ void sai_deserialize_buffer(
         _In_ size_t buffer_size, 
         _In_ void *buffer)
 {
-    unsigned char *mem = reinterpret_cast<unsigned char*>(buffer);
-
-    const char *ptr = s.c_str() + index;
-
-    for (size_t i = 0; i < buffer_size; i ++)
+    if (index < 0 || (size_t)index + 2 * buffer_size > s.size())
     {
-        int u = char_to_int(ptr[2 * i]);
-        int l = char_to_int(ptr[2 * i + 1]);
+        SWSS_LOG_ERROR("Unable to deserialize %zu bytes at index %d, string length is %zu",
+                buffer_size, index, s.size());
 
-        unsigned char c = (u << 4) | l;
-
-        mem[i] = c;
+        exit(EXIT_FAILURE);
     }
 
-    index += buffer_size * 2;
+    hex_decode(s.data() + index, buffer_size, reinterpret_cast<unsigned char*>(buffer));
 }
 
 void sai_free_buffer(void *buffer)
@@ -390,16 +823,11 @@ void sai_serialize_buffer(
         _In_ size_t buffer_size,
         _Out_ std::string &s)
 {
-    std::stringstream ss;
+    size_t offset = s.size();
 
-    unsigned const char* mem = reinterpret_cast<const unsigned char*>(buffer);
+    s.resize(offset + 2 * buffer_size);
 
-    for (size_t i = 0; i < buffer_size; i++)
-    {
-        ss << std::setfill('0') << std::setw(2) << std::hex << (unsigned int)mem[i];
-    }
-
-    s += ss.str();
+    hex_encode(reinterpret_cast<const unsigned char*>(buffer), buffer_size, &s[offset]);
 }
 
 sai_status_t sai_serialize_attr_id(
@@ -1651,3 +2079,127 @@ void sai_deserialize_route_entry(
 
     sai_deserialize_ip_prefix(s, index, re.destination);
 }
+
+static const char g_base64Chars[] =
+    "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+
+static int base64_value(
+        _In_ char c)
+{
+    if (c >= 'A' && c <= 'Z')
+        return c - 'A';
+
+    if (c >= 'a' && c <= 'z')
+        return c - 'a' + 26;
+
+    if (c >= '0' && c <= '9')
+        return c - '0' + 52;
+
+    if (c == '+')
+        return 62;
+
+    if (c == '/')
+        return 63;
+
+    return -1;
+}
+
+bool sai_is_compact_value(
+        _In_ const std::string &s)
+{
+    return s.size() > 0 && s[0] == '#';
+}
+
+void sai_serialize_compact_value(
+        _In_ const std::string &hex,
+        _Out_ std::string &s)
+{
+    size_t size = hex.size() / 2;
+
+    std::vector<unsigned char> bytes(size);
+
+    sai_deserialize_buffer(hex, 0, size, bytes.data());
+
+    s = SAI_COMPACT_VALUE_PREFIX;
+
+    s.reserve(s.size() + (size * 4 + 2) / 3);
+
+    for (size_t i = 0; i < size; i += 3)
+    {
+        uint32_t n = (uint32_t)bytes[i] << 16;
+
+        if (i + 1 < size)
+            n |= (uint32_t)bytes[i + 1] << 8;
+
+        if (i + 2 < size)
+            n |= (uint32_t)bytes[i + 2];
+
+        s += g_base64Chars[(n >> 18) & 0x3f];
+        s += g_base64Chars[(n >> 12) & 0x3f];
+
+        if (i + 1 < size)
+            s += g_base64Chars[(n >> 6) & 0x3f];
+
+        if (i + 2 < size)
+            s += g_base64Chars[n & 0x3f];
+    }
+}
+
+bool sai_deserialize_compact_value(
+        _In_ const std::string &s,
+        _Out_ std::string &hex)
+{
+    const size_t prefixLength = strlen(SAI_COMPACT_VALUE_PREFIX);
+
+    if (s.compare(0, prefixLength, SAI_COMPACT_VALUE_PREFIX) != 0)
+    {
+        SWSS_LOG_ERROR("invalid compact value: %s", s.c_str());
+        return false;
+    }
+
+    size_t length = s.size() - prefixLength;
+
+    // last group of 2 or 3 chars carries 1 or 2 bytes, single char can't
+    if (length % 4 == 1)
+    {
+        SWSS_LOG_ERROR("invalid compact value length: %s", s.c_str());
+        return false;
+    }
+
+    size_t size = length * 3 / 4;
+
+    std::vector<unsigned char> bytes;
+
+    bytes.reserve(size);
+
+    uint32_t n = 0;
+
+    int bits = 0;
+
+    for (size_t i = prefixLength; i < s.size(); i++)
+    {
+        int v = base64_value(s[i]);
+
+        if (v < 0)
+        {
+            SWSS_LOG_ERROR("invalid character in compact value: %s", s.c_str());
+            return false;
+        }
+
+        n = (n << 6) | (uint32_t)v;
+        bits += 6;
+
+        if (bits >= 8)
+        {
+            bits -= 8;
+
+            bytes.push_back((unsigned char)(n >> bits));
+        }
+    }
+
+    hex.clear();
+
+    sai_serialize_buffer(bytes.data(), bytes.size(), hex);
+
+    return true;
+}
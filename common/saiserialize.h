@@ -77,14 +77,18 @@ typedef enum _sai_attr_serialization_type_t
 
 typedef std::map<sai_object_type_t, std::string> sai_object_type_to_string_map_t;
 
-typedef std::map<sai_object_type_t, std::map<sai_attr_id_t, sai_attr_serialization_type_t>> sai_serialization_map_t;
+typedef struct _sai_serialization_entry_t
+{
+    sai_object_type_t object_type;
+    sai_attr_id_t attr_id;
+    sai_attr_serialization_type_t serialization_type;
+
+} sai_serialization_entry_t;
 
-sai_serialization_map_t sai_get_serialization_map();
 sai_object_type_to_string_map_t sai_get_object_type_map();
 
 sai_status_t sai_get_object_type_string(sai_object_type_t object_type, std::string &str_object_type);
 
-extern sai_serialization_map_t g_serialization_map;
 extern sai_object_type_to_string_map_t g_object_type_map;
 
 template<typename T>
@@ -175,19 +179,7 @@ void sai_deserialize_primitive(
 {
     size_t count = sizeof(T);
 
-    unsigned char *mem = reinterpret_cast<unsigned char*>(&element);
-
-    const char *ptr = s.c_str() + index;
-
-    for (size_t i = 0; i < count; i ++)
-    {
-        int u = char_to_int(ptr[2 * i]);
-        int l = char_to_int(ptr[2 * i + 1]);
-
-        unsigned char c = (u << 4) | l;
-
-        mem[i] = c;
-    }
+    sai_deserialize_buffer(s, index, count, &element);
 
     index += count * 2;
 }
@@ -336,4 +328,29 @@ void transfer_attributes(
 
 std::string sai_get_port_stat_counter_name(sai_port_stat_counter_t counter);
 
+/*
+ * Compact attribute value encoding.
+ *
+ * Format is "#<base64 of bytes>" without padding, where bytes are exactly
+ * what legacy hex value encodes and byte length follows from base64
+ * length. Redis values travel as JSON and %s formatted text, so raw
+ * binary can't be used and base64 is the densest safe option. Leading
+ * '#' is never produced by hex encoding, so both forms can be told apart
+ * and legacy values are always accepted. Values of up to 2 bytes are not
+ * shorter in compact form, writers keep them as hex.
+ */
+
+#define SAI_COMPACT_VALUE_PREFIX "#"
+
+bool sai_is_compact_value(
+        _In_ const std::string &s);
+
+void sai_serialize_compact_value(
+        _In_ const std::string &hex,
+        _Out_ std::string &s);
+
+bool sai_deserialize_compact_value(
+        _In_ const std::string &s,
+        _Out_ std::string &hex);
+
 #endif // __SAI_SERIALIZE__
@@ -0,0 +1,194 @@
+#include "saiserialize.h"
+
+#include <sstream>
+#include <iomanip>
+#include <chrono>
+#include <random>
+#include <vector>
+
+/*
+ * Compares hex codec used by sai_serialize_buffer and sai_deserialize_buffer
+ * with previous stringstream/char_to_int implementation, which is kept here
+ * as reference. First checks that output is byte identical, then prints
+ * throughput of both for several buffer sizes.
+ *
+ * Usage: saiserialize_bench [iterations scale, default 1]
+ */
+
+static int reference_char_to_int(
+        _In_ const char c)
+{
+    if (c >= '0' && c <= '9')
+        return c - '0';
+
+    if (c >= 'A' && c <= 'F')
+        return c - 'A' + 10;
+
+    if (c >= 'a' && c <= 'f')
+        return c - 'a' + 10;
+
+    fprintf(stderr, "Unable to convert char %d to int\n", c);
+
+    exit(EXIT_FAILURE);
+}
+
+static void reference_serialize_buffer(
+        _In_ const void *buffer,
+        _In_ size_t buffer_size,
+        _Out_ std::string &s)
+{
+    std::stringstream ss;
+
+    unsigned const char* mem = reinterpret_cast<const unsigned char*>(buffer);
+
+    for (size_t i = 0; i < buffer_size; i++)
+    {
+        ss << std::setfill('0') << std::setw(2) << std::hex << (unsigned int)mem[i];
+    }
+
+    s += ss.str();
+}
+
+static void reference_deserialize_buffer(
+        _In_ const std::string &s,
+        _In_ int index,
+        _In_ size_t buffer_size,
+        _In_ void *buffer)
+{
+    unsigned char *mem = reinterpret_cast<unsigned char*>(buffer);
+
+    const char *ptr = s.c_str() + index;
+
+    for (size_t i = 0; i < buffer_size; i ++)
+    {
+        int u = reference_char_to_int(ptr[2 * i]);
+        int l = reference_char_to_int(ptr[2 * i + 1]);
+
+        mem[i] = (unsigned char)((u << 4) | l);
+    }
+}
+
+static bool check_codec(
+        _In_ std::mt19937 &rng)
+{
+    for (size_t size = 0; size < 300; size++)
+    {
+        for (int rep = 0; rep < 20; rep++)
+        {
+            std::vector<unsigned char> buffer(size);
+
+            for (auto &b: buffer)
+                b = (unsigned char)rng();
+
+            std::string expected = "prefix";
+            std::string actual = "prefix";
+
+            reference_serialize_buffer(buffer.data(), size, expected);
+            sai_serialize_buffer(buffer.data(), size, actual);
+
+            if (expected != actual)
+            {
+                printf("serialize mismatch, size %zu\n", size);
+                return false;
+            }
+
+            // decoder must accept both cases
+            for (size_t i = 6; i < actual.size(); i++)
+            {
+                if (rng() & 1)
+                    actual[i] = (char)toupper(actual[i]);
+            }
+
+            std::vector<unsigned char> decoded(size);
+
+            sai_deserialize_buffer(actual, 6, size, decoded.data());
+
+            if (decoded != buffer)
+            {
+                printf("deserialize mismatch, size %zu\n", size);
+                return false;
+            }
+        }
+    }
+
+    return true;
+}
+
+template<typename F>
+static double measure(
+        _In_ size_t iterations,
+        _In_ size_t size,
+        _In_ F f)
+{
+    auto start = std::chrono::steady_clock::now();
+
+    for (size_t i = 0; i < iterations; i++)
+        f();
+
+    double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+    return (double)iterations * size / seconds / 1e6;
+}
+
+int main(int argc, char **argv)
+{
+    size_t scale = (argc > 1) ? std::max(1, atoi(argv[1])) : 1;
+
+    std::mt19937 rng(1);
+
+    if (!check_codec(rng))
+        return EXIT_FAILURE;
+
+    printf("output is byte identical to reference\n\n");
+
+    printf("throughput MB/s (reference -> current)\n\n");
+    printf("%8s %24s %24s\n", "size", "serialize", "deserialize");
+
+    const size_t sizes[] = { 4, 8, 48, 256, 4096 };
+
+    volatile unsigned char sink = 0;
+
+    for (size_t size: sizes)
+    {
+        std::vector<unsigned char> buffer(size);
+
+        for (auto &b: buffer)
+            b = (unsigned char)rng();
+
+        std::string encoded;
+
+        reference_serialize_buffer(buffer.data(), size, encoded);
+
+        std::vector<unsigned char> decoded(size);
+
+        size_t iterations = scale * ((64u << 20) / (size + 16));
+
+        // serialize figures include allocation of output string
+
+        double refSer = measure(iterations, size, [&] {
+                std::string s;
+                reference_serialize_buffer(buffer.data(), size, s);
+                sink += s[0];
+                });
+
+        double newSer = measure(iterations, size, [&] {
+                std::string s;
+                sai_serialize_buffer(buffer.data(), size, s);
+                sink += s[0];
+                });
+
+        double refDeser = measure(iterations, size, [&] {
+                reference_deserialize_buffer(encoded, 0, size, decoded.data());
+                sink += decoded[0];
+                });
+
+        double newDeser = measure(iterations, size, [&] {
+                sai_deserialize_buffer(encoded, 0, size, decoded.data());
+                sink += decoded[0];
+                });
+
+        printf("%8zu %10.0f -> %10.0f %10.0f -> %10.0f\n", size, refSer, newSer, refDeser, newDeser);
+    }
+
+    return EXIT_SUCCESS;
+}
@@ -9,6 +9,7 @@
 extern "C" {
 #include "sai.h"
 }
+#include "sairedis.h"
 #include "saiserialize.h"
 #include "saiattributelist.h"
 #include "redisclient.h"
@@ -28,8 +29,8 @@ extern swss::DBConnector               *g_db;
 extern swss::ProducerTable             *g_asicState;
 
 extern swss::NotificationProducer      *g_notifySyncdProducer;
-extern swss::ProducerTable             *g_redisGetProducer;
-extern swss::ConsumerTable             *g_redisGetConsumer;
+extern swss::NotificationProducer      *g_redisGetProducer;
+extern swss::NotificationConsumer      *g_redisGetConsumer;
 extern swss::NotificationConsumer      *g_redisNotifications;
 extern swss::NotificationConsumer      *g_notifySyncdConsumer;
 
@@ -70,6 +71,120 @@ extern sai_switch_notification_t redis_switch_notifications;
 
 #define UNREFERENCED_PARAMETER(X)
 
+/**
+ * @brief Profile key with number of virtual object ids leased from
+ * VIDCOUNTER in single redis call, default is 1024.
+ */
+#define SAI_REDIS_KEY_VID_LEASE_SIZE "SAI_REDIS_VID_LEASE_SIZE"
+
+void redis_reset_virtual_object_id_lease();
+
+void redis_start_get_response_thread();
+void redis_stop_get_response_thread();
+
+uint64_t redis_register_response();
+
+std::string redis_serialize_request_id(
+        _In_ uint64_t id);
+
+bool redis_deserialize_request_id(
+        _In_ const std::string &requestId,
+        _Out_ uint64_t &id);
+
+bool redis_wait_response(
+        _In_ uint64_t id,
+        _In_ uint32_t timeoutMs,
+        _Out_ std::string &status,
+        _Out_ std::vector<swss::FieldValueTuple> &values);
+
+/**
+ * @brief Profile key with maximum number of ASIC_STATE operations buffered
+ * and written to redis as single batch, 0 (default) disables buffering.
+ */
+#define SAI_REDIS_KEY_ASIC_STATE_BUFFER_SIZE "SAI_REDIS_ASIC_STATE_BUFFER_SIZE"
+
+/**
+ * @brief Profile key with maximum time in milliseconds operation can stay
+ * in ASIC_STATE buffer, default is 5.
+ */
+#define SAI_REDIS_KEY_ASIC_STATE_BUFFER_WINDOW "SAI_REDIS_ASIC_STATE_BUFFER_WINDOW_MS"
+
+void redis_asic_state_init();
+
+void redis_asic_state_flush();
+
+void redis_asic_state_set(
+        _In_ const std::string &key,
+        _In_ const std::vector<swss::FieldValueTuple> &values,
+        _In_ const std::string &op);
+
+void redis_asic_state_del(
+        _In_ const std::string &key,
+        _In_ const std::string &op);
+
+/**
+ * @brief Profile key selecting attribute value encoding, set to
+ * ATTR_ENCODING_COMPACT_V1 to use compact encoding when syncd supports it.
+ */
+#define SAI_REDIS_KEY_ATTR_ENCODING "SAI_REDIS_ATTR_ENCODING"
+
+/**
+ * @brief Profile key enabling local cache of attributes in libsairedis,
+ * set to "1" to answer gets of created, set and immutable attributes
+ * without round trip to syncd.
+ */
+#define SAI_REDIS_KEY_ATTR_CACHE "SAI_REDIS_ATTR_CACHE"
+
+void redis_attr_cache_init();
+
+void redis_attr_cache_create(
+        _In_ sai_object_type_t object_type,
+        _In_ const std::string &key,
+        _In_ uint32_t attr_count,
+        _In_ const sai_attribute_t *attr_list);
+
+void redis_attr_cache_set(
+        _In_ sai_object_type_t object_type,
+        _In_ const std::string &key,
+        _In_ const sai_attribute_t *attr);
+
+void redis_attr_cache_remove(
+        _In_ const std::string &key);
+
+void redis_attr_cache_update(
+        _In_ sai_object_type_t object_type,
+        _In_ const std::string &key,
+        _In_ uint32_t attr_count,
+        _In_ const sai_attribute_t *attr_list);
+
+bool redis_attr_cache_get(
+        _In_ sai_object_type_t object_type,
+        _In_ const std::string &key,
+        _In_ uint32_t attr_count,
+        _Inout_ sai_attribute_t *attr_list);
+
+void redis_attr_cache_get_stats(
+        _Out_ uint64_t &hits,
+        _Out_ uint64_t &misses);
+
+sai_status_t redis_bulk_generic_create(
+        _In_ sai_object_type_t object_type,
+        _In_ const std::vector<std::string> &serialized_object_ids,
+        _In_ const uint32_t *attr_count,
+        _In_ const sai_attribute_t *const *attr_list,
+        _Out_ sai_status_t *object_statuses);
+
+sai_status_t redis_bulk_generic_remove(
+        _In_ sai_object_type_t object_type,
+        _In_ const std::vector<std::string> &serialized_object_ids,
+        _Out_ sai_status_t *object_statuses);
+
+sai_status_t redis_bulk_generic_set(
+        _In_ sai_object_type_t object_type,
+        _In_ const std::vector<std::string> &serialized_object_ids,
+        _In_ const sai_attribute_t *attr_list,
+        _Out_ sai_status_t *object_statuses);
+
 sai_object_id_t redis_create_virtual_object_id(
         _In_ sai_object_type_t object_type);
 
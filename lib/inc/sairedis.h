@@ -0,0 +1,91 @@
+#ifndef __SAIREDIS__
+#define __SAIREDIS__
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+#include "sai.h"
+#ifdef __cplusplus
+}
+#endif
+
+/*
+ * Bulk operations of libsairedis, not part of SAI api.
+ *
+ * All entries of bulk operation are sent to syncd as single ASIC_STATE
+ * message and are applied by syncd in order, as single unit. Unlike
+ * single entry operations, bulk operations wait for syncd response and
+ * return status of each entry in object_statuses. Entries which failed
+ * are not applied, remaining ones are.
+ *
+ * Return value is SAI_STATUS_SUCCESS when all entries succeeded,
+ * SAI_STATUS_FAILURE otherwise.
+ */
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+sai_status_t sai_bulk_create_route_entry(
+        _In_ uint32_t object_count,
+        _In_ const sai_unicast_route_entry_t *route_entry,
+        _In_ const uint32_t *attr_count,
+        _In_ const sai_attribute_t *const *attr_list,
+        _Out_ sai_status_t *object_statuses);
+
+sai_status_t sai_bulk_remove_route_entry(
+        _In_ uint32_t object_count,
+        _In_ const sai_unicast_route_entry_t *route_entry,
+        _Out_ sai_status_t *object_statuses);
+
+sai_status_t sai_bulk_set_route_entry_attribute(
+        _In_ uint32_t object_count,
+        _In_ const sai_unicast_route_entry_t *route_entry,
+        _In_ const sai_attribute_t *attr_list,
+        _Out_ sai_status_t *object_statuses);
+
+sai_status_t sai_bulk_create_neighbor_entry(
+        _In_ uint32_t object_count,
+        _In_ const sai_neighbor_entry_t *neighbor_entry,
+        _In_ const uint32_t *attr_count,
+        _In_ const sai_attribute_t *const *attr_list,
+        _Out_ sai_status_t *object_statuses);
+
+sai_status_t sai_bulk_remove_neighbor_entry(
+        _In_ uint32_t object_count,
+        _In_ const sai_neighbor_entry_t *neighbor_entry,
+        _Out_ sai_status_t *object_statuses);
+
+sai_status_t sai_bulk_set_neighbor_entry_attribute(
+        _In_ uint32_t object_count,
+        _In_ const sai_neighbor_entry_t *neighbor_entry,
+        _In_ const sai_attribute_t *attr_list,
+        _Out_ sai_status_t *object_statuses);
+
+/*
+ * Object id of next hop which failed to create is set to
+ * SAI_NULL_OBJECT_ID.
+ */
+sai_status_t sai_bulk_create_next_hop(
+        _In_ uint32_t object_count,
+        _In_ const uint32_t *attr_count,
+        _In_ const sai_attribute_t *const *attr_list,
+        _Out_ sai_object_id_t *object_id,
+        _Out_ sai_status_t *object_statuses);
+
+sai_status_t sai_bulk_remove_next_hop(
+        _In_ uint32_t object_count,
+        _In_ const sai_object_id_t *object_id,
+        _Out_ sai_status_t *object_statuses);
+
+sai_status_t sai_bulk_set_next_hop_attribute(
+        _In_ uint32_t object_count,
+        _In_ const sai_object_id_t *object_id,
+        _In_ const sai_attribute_t *attr_list,
+        _Out_ sai_status_t *object_statuses);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // __SAIREDIS__
@@ -0,0 +1,242 @@
+#include "sai_redis.h"
+
+#include <thread>
+#include <condition_variable>
+#include <chrono>
+
+#define DEFAULT_ASIC_STATE_BUFFER_WINDOW_MS 5
+
+/*
+ * Buffer of ASIC_STATE operations, all access is under g_mutex.
+ *
+ * When enabled, create, set and remove are not written to ASIC_STATE one
+ * by one, but are kept in order and written as single "batch" entry:
+ *
+ * key:    batch:batch_id (pid:counter, unique across processes)
+ * op:     batch
+ * values: op:object_type:object_id -> serialized bulk attributes
+ *
+ * Syncd expands batch back to single operations in the same order, so
+ * from syncd point of view it's the same as if they were sent one by one.
+ * Buffer is flushed when it reaches size limit, when window since first
+ * buffered operation expires and before any operation which waits for
+ * syncd (get, bulk, notify syncd).
+ */
+
+struct AsicStateOperation
+{
+    std::string key;
+
+    std::string op;
+
+    std::vector<swss::FieldValueTuple> values;
+};
+
+static std::vector<AsicStateOperation> g_asicStateBuffer;
+
+// 0 means that buffering is disabled
+static size_t g_asicStateBufferSize = 0;
+
+static uint32_t g_asicStateBufferWindowMs = DEFAULT_ASIC_STATE_BUFFER_WINDOW_MS;
+
+static std::chrono::steady_clock::time_point g_asicStateBufferDeadline;
+
+static uint64_t g_asicStateBatchId = 0;
+
+static std::condition_variable g_asicStateBufferCondition;
+
+static bool g_asicStateFlushThreadStarted = false;
+
+static void internal_redis_asic_state_write(
+        _In_ AsicStateOperation &operation)
+{
+    SWSS_LOG_ENTER();
+
+    if (operation.op == "remove")
+        g_asicState->del(operation.key, operation.op);
+    else
+        g_asicState->set(operation.key, operation.values, operation.op);
+}
+
+void redis_asic_state_flush()
+{
+    SWSS_LOG_ENTER();
+
+    if (g_asicStateBuffer.empty())
+        return;
+
+    if (g_asicStateBuffer.size() == 1)
+    {
+        // no need to wrap single operation
+        internal_redis_asic_state_write(g_asicStateBuffer.front());
+
+        g_asicStateBuffer.clear();
+        return;
+    }
+
+    std::vector<swss::FieldValueTuple> entries;
+
+    entries.reserve(g_asicStateBuffer.size());
+
+    for (const auto &operation: g_asicStateBuffer)
+    {
+        std::string str_attributes = SaiAttributeList::serialize_bulk_attr_list(operation.values);
+
+        entries.push_back(swss::FieldValueTuple(operation.op + ":" + operation.key, str_attributes));
+    }
+
+    std::string key = "batch:" + redis_serialize_request_id(++g_asicStateBatchId);
+
+    SWSS_LOG_DEBUG("flushing %zu operations as %s", entries.size(), key.c_str());
+
+    g_asicState->set(key, entries, "batch");
+
+    g_asicStateBuffer.clear();
+}
+
+/*
+ * Flushes buffer when window expires, waits on g_mutex so it never
+ * interleaves with operations which are being buffered.
+ */
+static void asic_state_flush_thread()
+{
+    SWSS_LOG_ENTER();
+
+    std::unique_lock<std::mutex> lock(g_mutex);
+
+    while (true)
+    {
+        if (g_asicStateBuffer.empty())
+        {
+            g_asicStateBufferCondition.wait(lock);
+            continue;
+        }
+
+        if (std::chrono::steady_clock::now() < g_asicStateBufferDeadline)
+        {
+            g_asicStateBufferCondition.wait_until(lock, g_asicStateBufferDeadline);
+            continue;
+        }
+
+        redis_asic_state_flush();
+    }
+}
+
+/*
+ * Must be called under g_mutex after g_asicState was created.
+ */
+void redis_asic_state_init()
+{
+    SWSS_LOG_ENTER();
+
+    g_asicStateBuffer.clear();
+
+    g_asicStateBufferSize = 0;
+    g_asicStateBufferWindowMs = DEFAULT_ASIC_STATE_BUFFER_WINDOW_MS;
+
+    const char *value = g_services.profile_get_value(0, SAI_REDIS_KEY_ASIC_STATE_BUFFER_SIZE);
+
+    if (value != NULL)
+    {
+        long long size = strtoll(value, NULL, 0);
+
+        if (size < 0)
+        {
+            SWSS_LOG_WARN("invalid %s value '%s', buffering disabled", SAI_REDIS_KEY_ASIC_STATE_BUFFER_SIZE, value);
+        }
+        else
+        {
+            g_asicStateBufferSize = (size_t)size;
+        }
+    }
+
+    value = g_services.profile_get_value(0, SAI_REDIS_KEY_ASIC_STATE_BUFFER_WINDOW);
+
+    if (value != NULL)
+    {
+        long long window = strtoll(value, NULL, 0);
+
+        if (window <= 0)
+        {
+            SWSS_LOG_WARN("invalid %s value '%s', using default %d",
+                    SAI_REDIS_KEY_ASIC_STATE_BUFFER_WINDOW, value, DEFAULT_ASIC_STATE_BUFFER_WINDOW_MS);
+        }
+        else
+        {
+            g_asicStateBufferWindowMs = (uint32_t)window;
+        }
+    }
+
+    // single buffered operation is the same as no buffering
+    if (g_asicStateBufferSize <= 1)
+    {
+        g_asicStateBufferSize = 0;
+
+        SWSS_LOG_NOTICE("asic state buffering is disabled");
+        return;
+    }
+
+    SWSS_LOG_NOTICE("asic state buffering enabled, size: %zu, window: %u ms",
+            g_asicStateBufferSize, g_asicStateBufferWindowMs);
+
+    if (!g_asicStateFlushThreadStarted)
+    {
+        // thread runs for process lifetime, it can't be joined on api
+        // reinitialize since it needs g_mutex which is held there
+
+        std::thread(asic_state_flush_thread).detach();
+
+        g_asicStateFlushThreadStarted = true;
+    }
+}
+
+static void internal_redis_asic_state_push(
+        _In_ const std::string &key,
+        _In_ const std::vector<swss::FieldValueTuple> &values,
+        _In_ const std::string &op)
+{
+    SWSS_LOG_ENTER();
+
+    AsicStateOperation operation;
+
+    operation.key = key;
+    operation.op = op;
+    operation.values = values;
+
+    if (g_asicStateBufferSize == 0)
+    {
+        internal_redis_asic_state_write(operation);
+        return;
+    }
+
+    if (g_asicStateBuffer.empty())
+    {
+        g_asicStateBufferDeadline = std::chrono::steady_clock::now() + std::chrono::milliseconds(g_asicStateBufferWindowMs);
+
+        g_asicStateBufferCondition.notify_one();
+    }
+
+    g_asicStateBuffer.push_back(operation);
+
+    if (g_asicStateBuffer.size() >= g_asicStateBufferSize)
+        redis_asic_state_flush();
+}
+
+void redis_asic_state_set(
+        _In_ const std::string &key,
+        _In_ const std::vector<swss::FieldValueTuple> &values,
+        _In_ const std::string &op)
+{
+    SWSS_LOG_ENTER();
+
+    internal_redis_asic_state_push(key, values, op);
+}
+
+void redis_asic_state_del(
+        _In_ const std::string &key,
+        _In_ const std::string &op)
+{
+    SWSS_LOG_ENTER();
+
+    internal_redis_asic_state_push(key, std::vector<swss::FieldValueTuple>(), op);
+}
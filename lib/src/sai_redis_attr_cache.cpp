@@ -0,0 +1,324 @@
+#include "sai_redis.h"
+
+#include <set>
+#include <atomic>
+#include <unordered_map>
+
+// hit/miss statistics are logged every this number of cache lookups
+#define ATTR_CACHE_STATS_LOG_INTERVAL 10000
+
+/*
+ * Local view of attributes which are authoritative in this process:
+ * attributes passed to create and set (syncd exits when they fail, so
+ * they are always applied) and read only attributes which never change
+ * for object lifetime, cached on first successful get.
+ *
+ * Values are kept serialized, same as they are sent to syncd, so lists
+ * don't need to be deep copied and deserialization is the same as for
+ * syncd response.
+ */
+
+typedef std::unordered_map<sai_attr_id_t, swss::FieldValueTuple> AttrCacheEntry;
+
+static std::mutex g_attrCacheMutex;
+static std::unordered_map<std::string, AttrCacheEntry> g_attrCache;
+
+static bool g_attrCacheEnabled = false;
+
+static std::atomic<uint64_t> g_attrCacheHits(0);
+static std::atomic<uint64_t> g_attrCacheMisses(0);
+
+static const std::set<std::pair<sai_object_type_t, sai_attr_id_t>> g_immutableAttributes = {
+    { SAI_OBJECT_TYPE_SWITCH, SAI_SWITCH_ATTR_CPU_PORT },
+    { SAI_OBJECT_TYPE_SWITCH, SAI_SWITCH_ATTR_DEFAULT_VIRTUAL_ROUTER_ID },
+    { SAI_OBJECT_TYPE_SWITCH, SAI_SWITCH_ATTR_PORT_MAX_MTU },
+    { SAI_OBJECT_TYPE_SWITCH, SAI_SWITCH_ATTR_INGRESS_BUFFER_POOL_NUM },
+    { SAI_OBJECT_TYPE_SWITCH, SAI_SWITCH_ATTR_EGRESS_BUFFER_POOL_NUM },
+    { SAI_OBJECT_TYPE_SWITCH, SAI_SWITCH_ATTR_QOS_MAX_NUMBER_OF_CHILDS_PER_SCHEDULER_GROUP },
+    { SAI_OBJECT_TYPE_PORT, SAI_PORT_ATTR_HW_LANE_LIST },
+    { SAI_OBJECT_TYPE_PORT, SAI_PORT_ATTR_QOS_NUMBER_OF_QUEUES },
+    { SAI_OBJECT_TYPE_PORT, SAI_PORT_ATTR_QOS_QUEUE_LIST },
+    { SAI_OBJECT_TYPE_PORT, SAI_PORT_ATTR_QOS_NUMBER_OF_SCHEDULER_GROUPS },
+    { SAI_OBJECT_TYPE_PORT, SAI_PORT_ATTR_QOS_SCHEDULER_GROUP_LIST },
+    { SAI_OBJECT_TYPE_PORT, SAI_PORT_ATTR_NUMBER_OF_PRIORITY_GROUPS },
+    { SAI_OBJECT_TYPE_PORT, SAI_PORT_ATTR_PRIORITY_GROUP_LIST },
+};
+
+void redis_attr_cache_init()
+{
+    SWSS_LOG_ENTER();
+
+    std::lock_guard<std::mutex> lock(g_attrCacheMutex);
+
+    g_attrCache.clear();
+
+    g_attrCacheHits = 0;
+    g_attrCacheMisses = 0;
+
+    const char *value = g_services.profile_get_value(0, SAI_REDIS_KEY_ATTR_CACHE);
+
+    g_attrCacheEnabled = (value != NULL && strcmp(value, "1") == 0);
+
+    SWSS_LOG_NOTICE("attribute cache is %s", g_attrCacheEnabled ? "enabled" : "disabled");
+}
+
+static bool is_cacheable_object_type(
+        _In_ sai_object_type_t object_type)
+{
+    // fdb entries are learned and aged by hardware
+    return object_type != SAI_OBJECT_TYPE_FDB;
+}
+
+/*
+ * Only primitives and plain lists are cached, acl field and action data
+ * have enable flags and masks which are not worth of caching.
+ */
+static bool is_cacheable_attribute(
+        _In_ sai_object_type_t object_type,
+        _In_ sai_attr_id_t attr_id)
+{
+    sai_attr_serialization_type_t serialization_type;
+
+    if (sai_get_serialization_type(object_type, attr_id, serialization_type) != SAI_STATUS_SUCCESS)
+        return false;
+
+    return serialization_type <= SAI_SERIALIZATION_TYPE_VLAN_LIST;
+}
+
+/*
+ * Returns false when list of cached attribute don't fit into user
+ * buffer, then get is passed to syncd which will return overflow.
+ */
+static bool attribute_fits(
+        _In_ sai_object_type_t object_type,
+        _In_ const sai_attribute_t &src,
+        _In_ const sai_attribute_t &dst)
+{
+    sai_attr_serialization_type_t serialization_type;
+
+    if (sai_get_serialization_type(object_type, src.id, serialization_type) != SAI_STATUS_SUCCESS)
+        return false;
+
+    switch (serialization_type)
+    {
+        case SAI_SERIALIZATION_TYPE_OBJECT_LIST:
+            return src.value.objlist.count <= dst.value.objlist.count;
+
+        case SAI_SERIALIZATION_TYPE_UINT8_LIST:
+            return src.value.u8list.count <= dst.value.u8list.count;
+
+        case SAI_SERIALIZATION_TYPE_INT8_LIST:
+            return src.value.s8list.count <= dst.value.s8list.count;
+
+        case SAI_SERIALIZATION_TYPE_UINT16_LIST:
+            return src.value.u16list.count <= dst.value.u16list.count;
+
+        case SAI_SERIALIZATION_TYPE_INT16_LIST:
+            return src.value.s16list.count <= dst.value.s16list.count;
+
+        case SAI_SERIALIZATION_TYPE_UINT32_LIST:
+            return src.value.u32list.count <= dst.value.u32list.count;
+
+        case SAI_SERIALIZATION_TYPE_INT32_LIST:
+            return src.value.s32list.count <= dst.value.s32list.count;
+
+        case SAI_SERIALIZATION_TYPE_VLAN_LIST:
+            return src.value.vlanlist.count <= dst.value.vlanlist.count;
+
+        default:
+            return true;
+    }
+}
+
+static void internal_redis_attr_cache_put(
+        _In_ sai_object_type_t object_type,
+        _In_ const std::string &key,
+        _In_ uint32_t attr_count,
+        _In_ const sai_attribute_t *attr_list,
+        _In_ bool onlyImmutable)
+{
+    SWSS_LOG_ENTER();
+
+    std::vector<std::pair<sai_attr_id_t, swss::FieldValueTuple>> values;
+
+    for (uint32_t i = 0; i < attr_count; i++)
+    {
+        const sai_attribute_t &attr = attr_list[i];
+
+        if (onlyImmutable && g_immutableAttributes.find(std::make_pair(object_type, attr.id)) == g_immutableAttributes.end())
+            continue;
+
+        if (!is_cacheable_attribute(object_type, attr.id))
+            continue;
+
+        auto entry = SaiAttributeList::serialize_attr_list(object_type, 1, &attr, false);
+
+        values.push_back(std::make_pair(attr.id, entry.at(0)));
+    }
+
+    if (values.empty())
+        return;
+
+    std::lock_guard<std::mutex> lock(g_attrCacheMutex);
+
+    AttrCacheEntry &cached = g_attrCache[key];
+
+    for (auto &kv: values)
+    {
+        cached[kv.first] = kv.second;
+    }
+}
+
+void redis_attr_cache_create(
+        _In_ sai_object_type_t object_type,
+        _In_ const std::string &key,
+        _In_ uint32_t attr_count,
+        _In_ const sai_attribute_t *attr_list)
+{
+    SWSS_LOG_ENTER();
+
+    if (!g_attrCacheEnabled || !is_cacheable_object_type(object_type))
+        return;
+
+    {
+        // key could be reused after remove
+
+        std::lock_guard<std::mutex> lock(g_attrCacheMutex);
+
+        g_attrCache.erase(key);
+    }
+
+    internal_redis_attr_cache_put(object_type, key, attr_count, attr_list, false);
+}
+
+void redis_attr_cache_set(
+        _In_ sai_object_type_t object_type,
+        _In_ const std::string &key,
+        _In_ const sai_attribute_t *attr)
+{
+    SWSS_LOG_ENTER();
+
+    if (!g_attrCacheEnabled || !is_cacheable_object_type(object_type))
+        return;
+
+    internal_redis_attr_cache_put(object_type, key, 1, attr, false);
+}
+
+void redis_attr_cache_remove(
+        _In_ const std::string &key)
+{
+    SWSS_LOG_ENTER();
+
+    if (!g_attrCacheEnabled)
+        return;
+
+    std::lock_guard<std::mutex> lock(g_attrCacheMutex);
+
+    g_attrCache.erase(key);
+}
+
+/*
+ * Called after successful get from syncd, caches immutable attributes.
+ */
+void redis_attr_cache_update(
+        _In_ sai_object_type_t object_type,
+        _In_ const std::string &key,
+        _In_ uint32_t attr_count,
+        _In_ const sai_attribute_t *attr_list)
+{
+    SWSS_LOG_ENTER();
+
+    if (!g_attrCacheEnabled || !is_cacheable_object_type(object_type))
+        return;
+
+    internal_redis_attr_cache_put(object_type, key, attr_count, attr_list, true);
+}
+
+static void redis_attr_cache_log_stats()
+{
+    SWSS_LOG_ENTER();
+
+    uint64_t hits = g_attrCacheHits;
+    uint64_t misses = g_attrCacheMisses;
+
+    if ((hits + misses) % ATTR_CACHE_STATS_LOG_INTERVAL != 0)
+        return;
+
+    SWSS_LOG_NOTICE("attribute cache hits: %llu, misses: %llu", hits, misses);
+}
+
+/*
+ * Returns true when all requested attributes were answered from cache.
+ */
+bool redis_attr_cache_get(
+        _In_ sai_object_type_t object_type,
+        _In_ const std::string &key,
+        _In_ uint32_t attr_count,
+        _Inout_ sai_attribute_t *attr_list)
+{
+    SWSS_LOG_ENTER();
+
+    if (!g_attrCacheEnabled || attr_count == 0)
+        return false;
+
+    std::vector<swss::FieldValueTuple> values;
+
+    {
+        std::lock_guard<std::mutex> lock(g_attrCacheMutex);
+
+        auto it = g_attrCache.find(key);
+
+        if (it != g_attrCache.end())
+        {
+            for (uint32_t i = 0; i < attr_count; i++)
+            {
+                auto attr = it->second.find(attr_list[i].id);
+
+                if (attr == it->second.end())
+                    break;
+
+                values.push_back(attr->second);
+            }
+        }
+    }
+
+    bool hit = values.size() == attr_count;
+
+    if (hit)
+    {
+        SaiAttributeList list(object_type, values, false);
+
+        for (uint32_t i = 0; i < attr_count; i++)
+        {
+            if (!attribute_fits(object_type, list.get_attr_list()[i], attr_list[i]))
+            {
+                hit = false;
+                break;
+            }
+        }
+
+        if (hit)
+            transfer_attributes(object_type, attr_count, list.get_attr_list(), attr_list, false);
+    }
+
+    if (hit)
+        g_attrCacheHits++;
+    else
+        g_attrCacheMisses++;
+
+    SWSS_LOG_DEBUG("attribute cache %s key: %s", hit ? "hit" : "miss", key.c_str());
+
+    redis_attr_cache_log_stats();
+
+    return hit;
+}
+
+void redis_attr_cache_get_stats(
+        _Out_ uint64_t &hits,
+        _Out_ uint64_t &misses)
+{
+    SWSS_LOG_ENTER();
+
+    hits = g_attrCacheHits;
+    misses = g_attrCacheMisses;
+}
@@ -0,0 +1,188 @@
+#include "sai_redis.h"
+
+// bulk can contain many entries, but if syncd don't answer
+// in 60 seconds there is something wrong
+#define BULK_RESPONSE_TIMEOUT (60*1000)
+
+static std::string redis_bulk_object_key(
+        _In_ sai_object_type_t object_type,
+        _In_ const std::string &serialized_object_id)
+{
+    std::string str_object_type;
+
+    sai_serialize_primitive(object_type, str_object_type);
+
+    return str_object_type + ":" + serialized_object_id;
+}
+
+/*
+ * Bulk is sent as single ASIC_STATE message:
+ *
+ * key:    object_type:bulk:request_id (pid:counter)
+ * op:     bulkcreate, bulkremove or bulkset
+ * values: serialized object id -> serialized bulk attributes
+ *
+ * Syncd applies entries in order and sends response with the same
+ * request id, which contains status of each entry.
+ *
+ * Attribute cache entries of all bulk objects are invalidated when bulk
+ * is queued, under the same lock, so they are ordered with single
+ * operations. Cache is not populated from bulk, since entry status is
+ * only known after response, outside of the lock.
+ */
+sai_status_t internal_redis_bulk_generic(
+        _In_ sai_object_type_t object_type,
+        _In_ const std::string &op,
+        _In_ const std::vector<std::string> &serialized_object_ids,
+        _In_ const std::vector<std::string> &serialized_attributes,
+        _Out_ sai_status_t *object_statuses)
+{
+    SWSS_LOG_ENTER();
+
+    size_t count = serialized_object_ids.size();
+
+    std::vector<swss::FieldValueTuple> entries;
+
+    entries.reserve(count);
+
+    for (size_t idx = 0; idx < count; idx++)
+    {
+        entries.push_back(swss::FieldValueTuple(serialized_object_ids[idx], serialized_attributes[idx]));
+    }
+
+    std::string str_object_type;
+
+    sai_serialize_primitive(object_type, str_object_type);
+
+    uint64_t id = redis_register_response();
+
+    std::string key = str_object_type + ":bulk:" + redis_serialize_request_id(id);
+
+    SWSS_LOG_DEBUG("generic %s key: %s, entries: %zu", op.c_str(), key.c_str(), count);
+
+    {
+        // bulk must be in order with other operations, so it's passed
+        // by ASIC_STATE, only waiting for response is done without lock
+
+        std::lock_guard<std::mutex> lock(g_mutex);
+
+        redis_asic_state_flush();
+
+        g_asicState->set(key, entries, op);
+
+        for (const auto &serialized_object_id: serialized_object_ids)
+        {
+            redis_attr_cache_remove(redis_bulk_object_key(object_type, serialized_object_id));
+        }
+    }
+
+    std::string str_status;
+    std::vector<swss::FieldValueTuple> values;
+
+    if (!redis_wait_response(id, BULK_RESPONSE_TIMEOUT, str_status, values))
+    {
+        SWSS_LOG_ERROR("generic %s %s failed to get response", op.c_str(), key.c_str());
+
+        for (size_t idx = 0; idx < count; idx++)
+        {
+            object_statuses[idx] = SAI_STATUS_FAILURE;
+        }
+
+        return SAI_STATUS_FAILURE;
+    }
+
+    if (values.size() != count)
+    {
+        SWSS_LOG_ERROR("generic %s %s got %zu statuses, expected %zu", op.c_str(), key.c_str(), values.size(), count);
+
+        for (size_t idx = 0; idx < count; idx++)
+        {
+            object_statuses[idx] = SAI_STATUS_FAILURE;
+        }
+
+        return SAI_STATUS_FAILURE;
+    }
+
+    sai_status_t status = SAI_STATUS_SUCCESS;
+
+    for (size_t idx = 0; idx < count; idx++)
+    {
+        int index = 0;
+        sai_deserialize_primitive(fvValue(values[idx]), index, object_statuses[idx]);
+
+        if (object_statuses[idx] != SAI_STATUS_SUCCESS)
+            status = SAI_STATUS_FAILURE;
+    }
+
+    SWSS_LOG_DEBUG("generic %s status: %d", op.c_str(), status);
+
+    return status;
+}
+
+sai_status_t redis_bulk_generic_create(
+        _In_ sai_object_type_t object_type,
+        _In_ const std::vector<std::string> &serialized_object_ids,
+        _In_ const uint32_t *attr_count,
+        _In_ const sai_attribute_t *const *attr_list,
+        _Out_ sai_status_t *object_statuses)
+{
+    SWSS_LOG_ENTER();
+
+    std::vector<std::string> serialized_attributes;
+
+    for (size_t idx = 0; idx < serialized_object_ids.size(); idx++)
+    {
+        auto entry = SaiAttributeList::serialize_attr_list(object_type, attr_count[idx], attr_list[idx], false);
+
+        serialized_attributes.push_back(SaiAttributeList::serialize_bulk_attr_list(entry));
+    }
+
+    return internal_redis_bulk_generic(
+            object_type,
+            "bulkcreate",
+            serialized_object_ids,
+            serialized_attributes,
+            object_statuses);
+}
+
+sai_status_t redis_bulk_generic_remove(
+        _In_ sai_object_type_t object_type,
+        _In_ const std::vector<std::string> &serialized_object_ids,
+        _Out_ sai_status_t *object_statuses)
+{
+    SWSS_LOG_ENTER();
+
+    std::vector<std::string> serialized_attributes(serialized_object_ids.size());
+
+    return internal_redis_bulk_generic(
+            object_type,
+            "bulkremove",
+            serialized_object_ids,
+            serialized_attributes,
+            object_statuses);
+}
+
+sai_status_t redis_bulk_generic_set(
+        _In_ sai_object_type_t object_type,
+        _In_ const std::vector<std::string> &serialized_object_ids,
+        _In_ const sai_attribute_t *attr_list,
+        _Out_ sai_status_t *object_statuses)
+{
+    SWSS_LOG_ENTER();
+
+    std::vector<std::string> serialized_attributes;
+
+    for (size_t idx = 0; idx < serialized_object_ids.size(); idx++)
+    {
+        auto entry = SaiAttributeList::serialize_attr_list(object_type, 1, &attr_list[idx], false);
+
+        serialized_attributes.push_back(SaiAttributeList::serialize_bulk_attr_list(entry));
+    }
+
+    return internal_redis_bulk_generic(
+            object_type,
+            "bulkset",
+            serialized_object_ids,
+            serialized_attributes,
+            object_statuses);
+}
@@ -1,8 +1,48 @@
 #include "sai_redis.h"
 
+#define DEFAULT_VID_LEASE_SIZE 1024
+
+/*
+ * Range of virtual ids leased from shared VIDCOUNTER, values are handed
+ * out locally in (g_vidLeaseNext, g_vidLeaseEnd] range. Ids left in lease
+ * when process exits are simply never used, so restart is safe.
+ */
+uint64_t g_vidLeaseNext = 0;
+uint64_t g_vidLeaseEnd = 0;
+uint64_t g_vidLeaseSize = DEFAULT_VID_LEASE_SIZE;
+
+void redis_reset_virtual_object_id_lease()
+{
+    SWSS_LOG_ENTER();
+
+    g_vidLeaseNext = 0;
+    g_vidLeaseEnd = 0;
+    g_vidLeaseSize = DEFAULT_VID_LEASE_SIZE;
+
+    const char *value = g_services.profile_get_value(0, SAI_REDIS_KEY_VID_LEASE_SIZE);
+
+    if (value == NULL)
+        return;
+
+    long long leaseSize = strtoll(value, NULL, 0);
+
+    if (leaseSize <= 0)
+    {
+        SWSS_LOG_WARN("invalid %s value '%s', using default %d",
+                SAI_REDIS_KEY_VID_LEASE_SIZE, value, DEFAULT_VID_LEASE_SIZE);
+        return;
+    }
+
+    g_vidLeaseSize = (uint64_t)leaseSize;
+
+    SWSS_LOG_NOTICE("using VID lease size %llu", g_vidLeaseSize);
+}
+
 sai_object_id_t redis_create_virtual_object_id(
         _In_ sai_object_type_t object_type)
 {
+    std::lock_guard<std::mutex> lock(g_mutex);
+
     SWSS_LOG_ENTER();
 
     // when started, we need to get current status of
@@ -17,7 +57,18 @@ sai_object_id_t redis_create_virtual_object_id(
     // objects, but can be tricky since this information would need
     // to be stored somewhere in case of oa restart
 
-    uint64_t virtual_id = g_redisClient->incr("VIDCOUNTER");
+    if (g_vidLeaseNext == g_vidLeaseEnd)
+    {
+        // INCRBY is atomic, so syncd and other users of VIDCOUNTER
+        // will never get id from range leased here
+
+        g_vidLeaseEnd = g_redisClient->incrby("VIDCOUNTER", g_vidLeaseSize);
+        g_vidLeaseNext = g_vidLeaseEnd - g_vidLeaseSize;
+
+        SWSS_LOG_DEBUG("leased VID range (%llu, %llu]", g_vidLeaseNext, g_vidLeaseEnd);
+    }
+
+    uint64_t virtual_id = ++g_vidLeaseNext;
 
     sai_object_id_t objectId = (((sai_object_id_t)object_type) << 48) | virtual_id;
 
@@ -72,7 +123,9 @@ sai_status_t internal_redis_generic_create(
 
     SWSS_LOG_DEBUG("generic create key: %s, fields: %lu", key.c_str(), entry.size());
 
-    g_asicState->set(key, entry, "create");
+    redis_asic_state_set(key, entry, "create");
+
+    redis_attr_cache_create(object_type, key, attr_count, attr_list);
 
     // we assume create will always succeed which may not be true
     // we should make this synchronous call
@@ -1,5 +1,13 @@
 #include "sai_redis.h"
 
+#include <thread>
+#include <condition_variable>
+#include <atomic>
+
+#include "swss/selectableevent.h"
+
+#include <unistd.h>
+
 // if we don't receive response from syncd in 60 seconds
 // there is something wrong and we should fail
 #define GET_RESPONSE_TIMEOUT (60*1000)
@@ -8,17 +16,11 @@ sai_status_t internal_redis_get_process(
         _In_ sai_object_type_t object_type,
         _In_ uint32_t attr_count,
         _Out_ sai_attribute_t *attr_list,
-        _In_ swss::KeyOpFieldsValuesTuple &kco)
+        _In_ const std::string &str_sai_status,
+        _In_ const std::vector<swss::FieldValueTuple> &values)
 {
     SWSS_LOG_ENTER();
 
-    // key is: object_type:object_id:sai_status
-
-    const std::string &key = kfvKey(kco);
-    const std::vector<swss::FieldValueTuple> &values = kfvFieldsValues(kco);
-
-    std::string str_sai_status = key;
-
     sai_status_t status;
 
     int index = 0;
@@ -42,14 +44,204 @@ sai_status_t internal_redis_get_process(
     return status;
 }
 
+/*
+ * Request waiting for response. Requests are sent with unique id and
+ * response thread passes response to request with the same id, so gets
+ * (and bulk operations) from many threads can be in flight and don't hold
+ * g_mutex while waiting.
+ *
+ * Responses are published to all processes using libsairedis, so id sent
+ * to syncd is pid:counter and responses of other processes are ignored.
+ */
+struct PendingResponse
+{
+    PendingResponse():
+        done(false)
+    {
+    }
+
+    bool done;
+
+    std::string status;
+
+    std::vector<swss::FieldValueTuple> values;
+};
+
+static std::mutex g_responseMutex;
+static std::condition_variable g_responseCondition;
+static std::map<uint64_t, std::shared_ptr<PendingResponse>> g_pendingResponses;
+
+static std::atomic<uint64_t> g_requestId(0);
+
+// producer is not thread safe
+static std::mutex g_getSendMutex;
+
+static std::shared_ptr<std::thread> g_getResponseThread;
+
+static volatile bool g_getResponseThreadRun = false;
+
+// this event is used to nice end get response thread
+static swss::SelectableEvent g_getResponseThreadEvent;
+
+void get_response_thread()
+{
+    SWSS_LOG_ENTER();
+
+    swss::Select s;
+
+    s.addSelectable(g_redisGetConsumer);
+    s.addSelectable(&g_getResponseThreadEvent);
+
+    while (g_getResponseThreadRun)
+    {
+        swss::Selectable *sel;
+
+        int fd;
+
+        int result = s.select(&sel, &fd);
+
+        if (sel == &g_getResponseThreadEvent)
+            break;
+
+        if (result != swss::Select::OBJECT)
+            continue;
+
+        std::string requestId;
+        std::string status;
+        std::vector<swss::FieldValueTuple> values;
+
+        g_redisGetConsumer->pop(requestId, status, values);
+
+        SWSS_LOG_DEBUG("response: id = %s, status = %s", requestId.c_str(), status.c_str());
+
+        uint64_t id;
+
+        if (!redis_deserialize_request_id(requestId, id))
+        {
+            SWSS_LOG_DEBUG("response %s is for other process", requestId.c_str());
+            continue;
+        }
+
+        std::lock_guard<std::mutex> lock(g_responseMutex);
+
+        auto it = g_pendingResponses.find(id);
+
+        if (it == g_pendingResponses.end())
+        {
+            // request timed out
+            SWSS_LOG_DEBUG("no pending request with id %s", requestId.c_str());
+            continue;
+        }
+
+        it->second->status = status;
+        it->second->values.swap(values);
+        it->second->done = true;
+
+        g_responseCondition.notify_all();
+    }
+}
+
+void redis_start_get_response_thread()
+{
+    SWSS_LOG_ENTER();
+
+    redis_stop_get_response_thread();
+
+    g_getResponseThreadRun = true;
+
+    g_getResponseThread = std::make_shared<std::thread>(std::thread(get_response_thread));
+}
+
+void redis_stop_get_response_thread()
+{
+    SWSS_LOG_ENTER();
+
+    if (g_getResponseThread == NULL)
+        return;
+
+    g_getResponseThreadRun = false;
+
+    g_getResponseThreadEvent.notify();
+
+    g_getResponseThread->join();
+
+    g_getResponseThread = NULL;
+}
+
+std::string redis_serialize_request_id(
+        _In_ uint64_t id)
+{
+    SWSS_LOG_ENTER();
+
+    return std::to_string(getpid()) + ":" + std::to_string(id);
+}
+
+/*
+ * Returns false when request id was not created by this process.
+ */
+bool redis_deserialize_request_id(
+        _In_ const std::string &requestId,
+        _Out_ uint64_t &id)
+{
+    SWSS_LOG_ENTER();
+
+    size_t pos = requestId.find(':');
+
+    if (pos == std::string::npos || requestId.substr(0, pos) != std::to_string(getpid()))
+        return false;
+
+    id = strtoull(requestId.c_str() + pos + 1, NULL, 10);
+
+    return true;
+}
+
+uint64_t redis_register_response()
+{
+    SWSS_LOG_ENTER();
+
+    uint64_t id = ++g_requestId;
+
+    std::lock_guard<std::mutex> lock(g_responseMutex);
+
+    g_pendingResponses[id] = std::make_shared<PendingResponse>();
+
+    return id;
+}
+
+bool redis_wait_response(
+        _In_ uint64_t id,
+        _In_ uint32_t timeoutMs,
+        _Out_ std::string &status,
+        _Out_ std::vector<swss::FieldValueTuple> &values)
+{
+    SWSS_LOG_ENTER();
+
+    std::unique_lock<std::mutex> lock(g_responseMutex);
+
+    auto pending = g_pendingResponses.at(id);
+
+    g_responseCondition.wait_for(lock, std::chrono::milliseconds(timeoutMs), [&] { return pending->done; });
+
+    g_pendingResponses.erase(id);
+
+    if (!pending->done)
+        return false;
+
+    status.swap(pending->status);
+    values.swap(pending->values);
+
+    return true;
+}
+
 /**
  *   Routine Description:
- *    @brief Internal set attribute
+ *    @brief Internal get attribute
  *
  *  Arguments:
  *  @param[in] object_type - type of object
  *  @param[in] serialized_object_id - serialized object id
- *  @param[in] attr - attribute to serialize
+ *  @param[in] attr_count - number of attributes
+ *  @param[inout] attr_list - attributes to get
  *
  *  Return Values:
  *    @return  SAI_STATUS_SUCCESS on success
@@ -61,75 +253,71 @@ sai_status_t internal_redis_generic_get(
         _In_ uint32_t attr_count,
         _Out_ sai_attribute_t *attr_list)
 {
-    std::lock_guard<std::mutex> lock(g_mutex);
-
     SWSS_LOG_ENTER();
 
-    std::vector<swss::FieldValueTuple> entry = SaiAttributeList::serialize_attr_list(
-            object_type, 
-            attr_count,
-            attr_list,
-            false);
-
     std::string str_object_type;
 
     sai_serialize_primitive(object_type, str_object_type);
 
     std::string key = str_object_type + ":" + serialized_object_id;
 
-    SWSS_LOG_DEBUG("generic get key: %s, fields: %lu", key.c_str(), entry.size());
+    if (redis_attr_cache_get(object_type, key, attr_count, attr_list))
+        return SAI_STATUS_SUCCESS;
 
-    g_redisGetProducer->set(key, entry, "get");
-    g_redisGetProducer->del(key, "delget");
+    std::vector<swss::FieldValueTuple> entry = SaiAttributeList::serialize_attr_list(
+            object_type, 
+            attr_count,
+            attr_list,
+            false);
 
-    // wait for response
-    
-    swss::Select s;
+    uint64_t id = redis_register_response();
 
-    s.addSelectable(g_redisGetConsumer);
+    std::string requestId = redis_serialize_request_id(id);
 
-    while (true)
-    {
-        SWSS_LOG_DEBUG("wait for response");
+    SWSS_LOG_DEBUG("generic get id: %s, key: %s, fields: %lu", requestId.c_str(), key.c_str(), entry.size());
 
-        swss::Selectable *sel;
+    {
+        // get must see all operations issued before it
 
-        int fd;
+        std::lock_guard<std::mutex> lock(g_mutex);
 
-        int result = s.select(&sel, &fd, GET_RESPONSE_TIMEOUT);
+        redis_asic_state_flush();
+    }
 
-        if (result == swss::Select::OBJECT)
-        {
-            swss::KeyOpFieldsValuesTuple kco;
+    int64_t receivers;
 
-            g_redisGetConsumer->pop(kco);
+    {
+        std::lock_guard<std::mutex> lock(g_getSendMutex);
 
-            const std::string &op = kfvOp(kco); 
-            const std::string &key = kfvKey(kco);
+        receivers = g_redisGetProducer->send(requestId, key, entry);
+    }
 
-            SWSS_LOG_DEBUG("response: op = %s, key = %s", key.c_str(), op.c_str());
+    // request is notification, when syncd is not listening nobody will
+    // answer, so don't wait for timeout
 
-            if (op != "getresponse") // ignore non response messages
-                continue;
+    std::string str_status;
+    std::vector<swss::FieldValueTuple> values;
 
-            sai_status_t status = internal_redis_get_process(
-                    object_type, 
-                    attr_count, 
-                    attr_list, 
-                    kco);
+    if (!redis_wait_response(id, receivers > 0 ? GET_RESPONSE_TIMEOUT : 0, str_status, values))
+    {
+        SWSS_LOG_ERROR("generic get %s failed to get response, receivers: %lld", key.c_str(), (long long)receivers);
 
-            SWSS_LOG_DEBUG("generic get status: %d", status);
+        return SAI_STATUS_FAILURE;
+    }
 
-            return status;
-        }
+    sai_status_t status = internal_redis_get_process(
+            object_type,
+            attr_count,
+            attr_list,
+            str_status,
+            values);
 
-        SWSS_LOG_ERROR("generic get failed to get response result: %d", result);
-        break;
-    }
+    SWSS_LOG_DEBUG("generic get status: %d", status);
 
-    SWSS_LOG_ERROR("generic get failed to get response");
+    if (status == SAI_STATUS_SUCCESS)
+        redis_attr_cache_update(object_type, key, attr_count, attr_list);
 
-    return SAI_STATUS_FAILURE;
+    return status;
 }
 
 /**
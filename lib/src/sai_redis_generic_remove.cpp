@@ -16,7 +16,9 @@ sai_status_t internal_redis_generic_remove(
 
     SWSS_LOG_DEBUG("generic remove key: %s", key.c_str());
 
-    g_asicState->del(key, "remove");
+    redis_asic_state_del(key, "remove");
+
+    redis_attr_cache_remove(key);
 
     return SAI_STATUS_SUCCESS;
 }
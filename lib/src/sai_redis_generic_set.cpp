@@ -36,7 +36,9 @@ sai_status_t internal_redis_generic_set(
 
     SWSS_LOG_DEBUG("generic set key: %s, fields: %lu", key.c_str(), entry.size());
 
-    g_asicState->set(key, entry, "set");
+    redis_asic_state_set(key, entry, "set");
+
+    redis_attr_cache_set(object_type, key, attr);
 
     return SAI_STATUS_SUCCESS;
 }
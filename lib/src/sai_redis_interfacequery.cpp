@@ -9,17 +9,56 @@ bool                   g_apiInitialized = false;
 
 swss::DBConnector     *g_db = NULL;
 swss::DBConnector     *g_dbNtf = NULL;
+swss::DBConnector     *g_dbGet = NULL;
 swss::ProducerTable   *g_asicState = NULL;
 
-// we probably don't need those to tables to access GET requests
 swss::NotificationProducer   *g_notifySyncdProducer = NULL;
-swss::ProducerTable          *g_redisGetProducer = NULL;
-swss::ConsumerTable          *g_redisGetConsumer = NULL;
+swss::NotificationProducer   *g_redisGetProducer = NULL;
+swss::NotificationConsumer   *g_redisGetConsumer = NULL;
 swss::NotificationConsumer   *g_redisNotifications = NULL;
 swss::NotificationConsumer   *g_notifySyncdConsumer = NULL;
 
 swss::RedisClient     *g_redisClient = NULL;
 
+void redis_negotiate_attr_encoding()
+{
+    SWSS_LOG_ENTER();
+
+    SaiAttributeList::set_compact_encoding(false);
+
+    const char *encoding = g_services.profile_get_value(0, SAI_REDIS_KEY_ATTR_ENCODING);
+
+    if (encoding == NULL || strcmp(encoding, ATTR_ENCODING_COMPACT_V1) != 0)
+        return;
+
+    // syncd puts list of encodings it can decode in HIDDEN hash on start
+
+    auto supported = g_redisClient->hget("HIDDEN", ATTR_ENCODINGS_FIELD);
+
+    if (supported == NULL)
+    {
+        SWSS_LOG_WARN("syncd didn't advertise attribute encodings, using hex");
+        return;
+    }
+
+    std::istringstream iss(*supported);
+
+    std::string item;
+
+    while (iss >> item)
+    {
+        if (item == ATTR_ENCODING_COMPACT_V1)
+        {
+            SWSS_LOG_NOTICE("using %s attribute encoding", ATTR_ENCODING_COMPACT_V1);
+
+            SaiAttributeList::set_compact_encoding(true);
+            return;
+        }
+    }
+
+    SWSS_LOG_WARN("syncd doesn't support %s attribute encoding, using hex", ATTR_ENCODING_COMPACT_V1);
+}
+
 sai_status_t sai_api_initialize(
         _In_ uint64_t flags,
         _In_ const service_method_table_t* services)
@@ -42,6 +81,10 @@ sai_status_t sai_api_initialize(
         return SAI_STATUS_INVALID_PARAMETER;
     }
 
+    // operations buffered before reinitialize go to old connection
+    if (g_asicState != NULL)
+        redis_asic_state_flush();
+
     if (g_db != NULL)
         delete g_db;
 
@@ -52,6 +95,15 @@ sai_status_t sai_api_initialize(
 
     g_dbNtf = new swss::DBConnector(ASIC_DB, "localhost", 6379, 0);
 
+    // get requests are sent without g_mutex, so they need own connection
+
+    redis_stop_get_response_thread();
+
+    if (g_dbGet != NULL)
+        delete g_dbGet;
+
+    g_dbGet = new swss::DBConnector(ASIC_DB, "localhost", 6379, 0);
+
     if (g_asicState != NULL)
         delete g_asicState;
 
@@ -65,7 +117,7 @@ sai_status_t sai_api_initialize(
     if (g_redisGetProducer != NULL)
         delete g_redisGetProducer;
 
-    g_redisGetProducer = new swss::ProducerTable(g_db, "GETREQUEST");
+    g_redisGetProducer = new swss::NotificationProducer(g_dbGet, "GETREQUEST");
 
     if (g_notifySyncdConsumer != NULL)
         delete g_notifySyncdConsumer;
@@ -75,7 +127,7 @@ sai_status_t sai_api_initialize(
     if (g_redisGetConsumer != NULL)
         delete g_redisGetConsumer;
 
-    g_redisGetConsumer = new swss::ConsumerTable(g_db, "GETRESPONSE");
+    g_redisGetConsumer = new swss::NotificationConsumer(g_dbGet, "GETRESPONSE");
 
     if (g_redisNotifications != NULL)
         delete g_redisNotifications;
@@ -87,6 +139,16 @@ sai_status_t sai_api_initialize(
 
     g_redisClient = new swss::RedisClient(g_db);
 
+    redis_reset_virtual_object_id_lease();
+
+    redis_attr_cache_init();
+
+    redis_asic_state_init();
+
+    redis_start_get_response_thread();
+
+    redis_negotiate_attr_encoding();
+
     g_apiInitialized = true;
 
     return SAI_STATUS_SUCCESS;
@@ -109,6 +109,160 @@ sai_status_t  redis_get_next_hop_attribute(
     return status;
 }
 
+/**
+ * Routine Description:
+ *    @brief Bulk create next hops
+ *
+ * Arguments:
+ *    @param[in] object_count - number of next hops
+ *    @param[in] attr_count - number of attributes of each next hop
+ *    @param[in] attr_list - attributes of each next hop
+ *    @param[out] object_id - next hop ids
+ *    @param[out] object_statuses - status of each next hop
+ *
+ * Return Values:
+ *    @return SAI_STATUS_SUCCESS when all next hops were created
+ *            Failure status code on error
+ */
+sai_status_t sai_bulk_create_next_hop(
+        _In_ uint32_t object_count,
+        _In_ const uint32_t *attr_count,
+        _In_ const sai_attribute_t *const *attr_list,
+        _Out_ sai_object_id_t *object_id,
+        _Out_ sai_status_t *object_statuses)
+{
+    SWSS_LOG_ENTER();
+
+    if (object_count == 0)
+        return SAI_STATUS_SUCCESS;
+
+    if (attr_count == NULL || attr_list == NULL || object_id == NULL || object_statuses == NULL)
+    {
+        SWSS_LOG_ERROR("NULL pointer passed to bulk create");
+        return SAI_STATUS_INVALID_PARAMETER;
+    }
+
+    std::vector<std::string> serialized_object_ids;
+
+    for (uint32_t idx = 0; idx < object_count; idx++)
+    {
+        object_id[idx] = redis_create_virtual_object_id(SAI_OBJECT_TYPE_NEXT_HOP);
+
+        std::string str_object_id;
+        sai_serialize_primitive(object_id[idx], str_object_id);
+
+        serialized_object_ids.push_back(str_object_id);
+    }
+
+    sai_status_t status = redis_bulk_generic_create(
+            SAI_OBJECT_TYPE_NEXT_HOP,
+            serialized_object_ids,
+            attr_count,
+            attr_list,
+            object_statuses);
+
+    for (uint32_t idx = 0; idx < object_count; idx++)
+    {
+        if (object_statuses[idx] != SAI_STATUS_SUCCESS)
+            object_id[idx] = SAI_NULL_OBJECT_ID;
+    }
+
+    return status;
+}
+
+/**
+ * Routine Description:
+ *    @brief Bulk remove next hops
+ *
+ * Arguments:
+ *    @param[in] object_count - number of next hops
+ *    @param[in] object_id - next hop ids
+ *    @param[out] object_statuses - status of each next hop
+ *
+ * Return Values:
+ *    @return SAI_STATUS_SUCCESS when all next hops were removed
+ *            Failure status code on error
+ */
+sai_status_t sai_bulk_remove_next_hop(
+        _In_ uint32_t object_count,
+        _In_ const sai_object_id_t *object_id,
+        _Out_ sai_status_t *object_statuses)
+{
+    SWSS_LOG_ENTER();
+
+    if (object_count == 0)
+        return SAI_STATUS_SUCCESS;
+
+    if (object_id == NULL || object_statuses == NULL)
+    {
+        SWSS_LOG_ERROR("NULL pointer passed to bulk remove");
+        return SAI_STATUS_INVALID_PARAMETER;
+    }
+
+    std::vector<std::string> serialized_object_ids;
+
+    for (uint32_t idx = 0; idx < object_count; idx++)
+    {
+        std::string str_object_id;
+        sai_serialize_primitive(object_id[idx], str_object_id);
+
+        serialized_object_ids.push_back(str_object_id);
+    }
+
+    return redis_bulk_generic_remove(
+            SAI_OBJECT_TYPE_NEXT_HOP,
+            serialized_object_ids,
+            object_statuses);
+}
+
+/**
+ * Routine Description:
+ *    @brief Bulk set next hop attribute
+ *
+ * Arguments:
+ *    @param[in] object_count - number of next hops
+ *    @param[in] object_id - next hop ids
+ *    @param[in] attr_list - attribute of each next hop
+ *    @param[out] object_statuses - status of each next hop
+ *
+ * Return Values:
+ *    @return SAI_STATUS_SUCCESS when all next hops succeeded
+ *            Failure status code on error
+ */
+sai_status_t sai_bulk_set_next_hop_attribute(
+        _In_ uint32_t object_count,
+        _In_ const sai_object_id_t *object_id,
+        _In_ const sai_attribute_t *attr_list,
+        _Out_ sai_status_t *object_statuses)
+{
+    SWSS_LOG_ENTER();
+
+    if (object_count == 0)
+        return SAI_STATUS_SUCCESS;
+
+    if (object_id == NULL || attr_list == NULL || object_statuses == NULL)
+    {
+        SWSS_LOG_ERROR("NULL pointer passed to bulk set");
+        return SAI_STATUS_INVALID_PARAMETER;
+    }
+
+    std::vector<std::string> serialized_object_ids;
+
+    for (uint32_t idx = 0; idx < object_count; idx++)
+    {
+        std::string str_object_id;
+        sai_serialize_primitive(object_id[idx], str_object_id);
+
+        serialized_object_ids.push_back(str_object_id);
+    }
+
+    return redis_bulk_generic_set(
+            SAI_OBJECT_TYPE_NEXT_HOP,
+            serialized_object_ids,
+            attr_list,
+            object_statuses);
+}
+
 /**
  *  @brief Next Hop methods table retrieved with sai_api_query()
  */
@@ -113,6 +113,150 @@ sai_status_t  redis_get_route_attribute(
 }
 
 
+/**
+ * Routine Description:
+ *    @brief Bulk create route
+ *
+ * Arguments:
+ *    @param[in] object_count - number of routes
+ *    @param[in] route_entry - array of route entries
+ *    @param[in] attr_count - number of attributes of each entry
+ *    @param[in] attr_list - attributes of each entry
+ *    @param[out] object_statuses - status of each entry
+ *
+ * Return Values:
+ *    @return SAI_STATUS_SUCCESS when all entries succeeded
+ *            Failure status code on error
+ */
+sai_status_t sai_bulk_create_route_entry(
+        _In_ uint32_t object_count,
+        _In_ const sai_unicast_route_entry_t *route_entry,
+        _In_ const uint32_t *attr_count,
+        _In_ const sai_attribute_t *const *attr_list,
+        _Out_ sai_status_t *object_statuses)
+{
+    SWSS_LOG_ENTER();
+
+    if (object_count == 0)
+        return SAI_STATUS_SUCCESS;
+
+    if (route_entry == NULL || attr_count == NULL || attr_list == NULL || object_statuses == NULL)
+    {
+        SWSS_LOG_ERROR("NULL pointer passed to bulk create");
+        return SAI_STATUS_INVALID_PARAMETER;
+    }
+
+    std::vector<std::string> serialized_object_ids;
+
+    for (uint32_t idx = 0; idx < object_count; idx++)
+    {
+        std::string str_route_entry;
+        sai_serialize_route_entry(route_entry[idx], str_route_entry);
+
+        serialized_object_ids.push_back(str_route_entry);
+    }
+
+    return redis_bulk_generic_create(
+            SAI_OBJECT_TYPE_ROUTE,
+            serialized_object_ids,
+            attr_count,
+            attr_list,
+            object_statuses);
+}
+
+/**
+ * Routine Description:
+ *    @brief Bulk remove route
+ *
+ * Arguments:
+ *    @param[in] object_count - number of routes
+ *    @param[in] route_entry - array of route entries
+ *    @param[out] object_statuses - status of each entry
+ *
+ * Return Values:
+ *    @return SAI_STATUS_SUCCESS when all entries succeeded
+ *            Failure status code on error
+ */
+sai_status_t sai_bulk_remove_route_entry(
+        _In_ uint32_t object_count,
+        _In_ const sai_unicast_route_entry_t *route_entry,
+        _Out_ sai_status_t *object_statuses)
+{
+    SWSS_LOG_ENTER();
+
+    if (object_count == 0)
+        return SAI_STATUS_SUCCESS;
+
+    if (route_entry == NULL || object_statuses == NULL)
+    {
+        SWSS_LOG_ERROR("NULL pointer passed to bulk remove");
+        return SAI_STATUS_INVALID_PARAMETER;
+    }
+
+    std::vector<std::string> serialized_object_ids;
+
+    for (uint32_t idx = 0; idx < object_count; idx++)
+    {
+        std::string str_route_entry;
+        sai_serialize_route_entry(route_entry[idx], str_route_entry);
+
+        serialized_object_ids.push_back(str_route_entry);
+    }
+
+    return redis_bulk_generic_remove(
+            SAI_OBJECT_TYPE_ROUTE,
+            serialized_object_ids,
+            object_statuses);
+}
+
+/**
+ * Routine Description:
+ *    @brief Bulk set route attribute
+ *
+ * Arguments:
+ *    @param[in] object_count - number of routes
+ *    @param[in] route_entry - array of route entries
+ *    @param[in] attr_list - attribute of each entry
+ *    @param[out] object_statuses - status of each entry
+ *
+ * Return Values:
+ *    @return SAI_STATUS_SUCCESS when all entries succeeded
+ *            Failure status code on error
+ */
+sai_status_t sai_bulk_set_route_entry_attribute(
+        _In_ uint32_t object_count,
+        _In_ const sai_unicast_route_entry_t *route_entry,
+        _In_ const sai_attribute_t *attr_list,
+        _Out_ sai_status_t *object_statuses)
+{
+    SWSS_LOG_ENTER();
+
+    if (object_count == 0)
+        return SAI_STATUS_SUCCESS;
+
+    if (route_entry == NULL || attr_list == NULL || object_statuses == NULL)
+    {
+        SWSS_LOG_ERROR("NULL pointer passed to bulk set");
+        return SAI_STATUS_INVALID_PARAMETER;
+    }
+
+    std::vector<std::string> serialized_object_ids;
+
+    for (uint32_t idx = 0; idx < object_count; idx++)
+    {
+        std::string str_route_entry;
+        sai_serialize_route_entry(route_entry[idx], str_route_entry);
+
+        serialized_object_ids.push_back(str_route_entry);
+    }
+
+    return redis_bulk_generic_set(
+            SAI_OBJECT_TYPE_ROUTE,
+            serialized_object_ids,
+            attr_list,
+            object_statuses);
+}
+
 /**
  *  @brief Router entry methods table retrieved with sai_api_query()
  */
@@ -65,6 +65,8 @@ sai_status_t notify_syncd(const std::string &op)
 {
     SWSS_LOG_ENTER();
 
+    redis_asic_state_flush();
+
     std::vector<swss::FieldValueTuple> entry;
 
     g_notifySyncdProducer->send(op, "", entry);
@@ -58,20 +58,9 @@ sai_object_id_t translate_rid_to_vid(
 
     sai_object_id_t vid;
 
-    std::string str_rid;
-    std::string str_vid;
-
-    sai_serialize_primitive(rid, str_rid);
-
-    auto pvid = g_redisClient->hget(RIDTOVID, str_rid);
-
-    if (pvid != NULL)
+    if (vidRidCacheGetVid(rid, vid))
     {
         // object exists
-        str_vid = *pvid;
-
-        int index = 0;
-        sai_deserialize_primitive(str_vid, index, vid);
 
         SWSS_LOG_DEBUG("translated RID %llx to VID %llx", rid, vid);
 
@@ -93,10 +82,7 @@ sai_object_id_t translate_rid_to_vid(
 
     SWSS_LOG_DEBUG("translated RID %llx to VID %llx", rid, vid);
 
-    sai_serialize_primitive(vid, str_vid);
-
-    g_redisClient->hset(RIDTOVID, str_rid, str_vid);
-    g_redisClient->hset(VIDTORID, str_vid, str_rid);
+    vidRidCacheInsert(vid, rid);
 
     return vid;
 }
@@ -183,27 +169,15 @@ sai_object_id_t translate_vid_to_rid(
         return SAI_NULL_OBJECT_ID;
     }
 
-    std::string str_vid;
-    sai_serialize_primitive(vid, str_vid);
-
-    std::string str_rid;
-
-    auto prid = g_redisClient->hget(VIDTORID, str_vid);
+    sai_object_id_t rid;
 
-    if (prid == NULL)
+    if (!vidRidCacheGetRid(vid, rid))
     {
-        SWSS_LOG_ERROR("unable to get RID for VID: %s", str_vid.c_str());
+        SWSS_LOG_ERROR("unable to get RID for VID: %llx", vid);
 
         exit(EXIT_FAILURE);
     }
 
-    str_rid = *prid;
-
-    sai_object_id_t rid;
-
-    int index = 0;
-    sai_deserialize_primitive(str_rid, index, rid);
-
     SWSS_LOG_DEBUG("translated VID %llx to RID %llx", vid, rid);
 
     return rid;
@@ -269,6 +243,7 @@ void translate_vid_to_rid_list(
 }
 
 void internal_syncd_get_send(
+        _In_ const std::string &requestId,
         _In_ sai_object_type_t object_type,
         _In_ sai_status_t status,
         _In_ uint32_t attr_count,
@@ -312,17 +287,13 @@ void internal_syncd_get_send(
     std::string str_status;
     sai_serialize_primitive(status, str_status);
 
-    std::string key = str_status;
-
-    // since we have only one get at a time, we don't have to serialize
-    // object type and object id, only get status is required
-    getResponse->set(key, entry, "getresponse");
-    getResponse->del(key, "delgetresponse");
+    // many gets can be in flight, sairedis matches response by request id
+    getResponse->send(requestId, str_status, entry);
 }
 
 
-swss::ConsumerTable         *getRequest = NULL;
-swss::ProducerTable         *getResponse = NULL;
+swss::NotificationConsumer  *getRequest = NULL;
+swss::NotificationProducer  *getResponse = NULL;
 swss::NotificationProducer  *notifications = NULL;
 
 const char* profile_get_value(
@@ -431,16 +402,9 @@ sai_status_t handle_generic(
                     // object was created so new object id was generated
                     // we need to save virtual id's to redis db
 
-                    std::string str_vid;
-                    std::string str_rid;
-
-                    sai_serialize_primitive(object_id, str_vid);
-                    sai_serialize_primitive(real_object_id, str_rid);
+                    vidRidCacheInsert(object_id, real_object_id);
 
-                    g_redisClient->hset(VIDTORID, str_vid, str_rid);
-                    g_redisClient->hset(RIDTOVID, str_rid, str_vid);
-
-                    SWSS_LOG_INFO("saved VID %s to RID %s", str_vid.c_str(), str_rid.c_str());
+                    SWSS_LOG_INFO("saved VID %llx to RID %llx", object_id, real_object_id);
                 }
                 else
                 {
@@ -464,14 +428,7 @@ sai_status_t handle_generic(
 
                 sai_object_id_t rid = translate_vid_to_rid(object_id);
 
-                std::string str_vid;
-                sai_serialize_primitive(object_id, str_vid);
-
-                std::string str_rid;
-                sai_serialize_primitive(rid, str_rid);
-
-                g_redisClient->hdel(VIDTORID, str_vid);
-                g_redisClient->hdel(RIDTOVID, str_rid);
+                vidRidCacheRemove(object_id, rid);
 
                 return remove(rid);
             }
@@ -565,7 +522,21 @@ sai_status_t handle_switch(
             return SAI_STATUS_NOT_SUPPORTED;
 
         case SAI_COMMON_API_SET:
-            return sai_switch_api->set_switch_attribute(attr_list);
+            {
+                sai_status_t status = sai_switch_api->set_switch_attribute(attr_list);
+
+                // switch attributes (like port breakout) can change port
+                // list, switch set is rare so just invalidate port list
+
+                if (status == SAI_STATUS_SUCCESS)
+                {
+                    saiInvalidatePortList();
+
+                    invalidatePortCountersCapabilities(SAI_NULL_OBJECT_ID);
+                }
+
+                return status;
+            }
 
         case SAI_COMMON_API_GET:
             return sai_switch_api->get_switch_attribute(attr_count, attr_list);
@@ -706,18 +677,182 @@ sai_status_t handle_trap(
     }
 }
 
-sai_status_t processEvent(swss::ConsumerTable &consumer)
+sai_status_t handle_api(
+        _In_ sai_object_type_t object_type,
+        _In_ std::string &str_object_id,
+        _In_ sai_common_api_t api,
+        _In_ uint32_t attr_count,
+        _In_ sai_attribute_t *attr_list)
 {
-    std::lock_guard<std::mutex> lock(g_mutex);
+    SWSS_LOG_ENTER();
+
+    switch (object_type)
+    {
+        case SAI_OBJECT_TYPE_FDB:
+            return handle_fdb(str_object_id, api, attr_count, attr_list);
 
+        case SAI_OBJECT_TYPE_SWITCH:
+            return handle_switch(str_object_id, api, attr_count, attr_list);
+
+        case SAI_OBJECT_TYPE_NEIGHBOR:
+            return handle_neighbor(str_object_id, api, attr_count, attr_list);
+
+        case SAI_OBJECT_TYPE_ROUTE:
+            return handle_route(str_object_id, api, attr_count, attr_list);
+
+        case SAI_OBJECT_TYPE_VLAN:
+            return handle_vlan(str_object_id, api, attr_count, attr_list);
+
+        case SAI_OBJECT_TYPE_TRAP:
+            return handle_trap(str_object_id, api, attr_count, attr_list);
+
+        default:
+            return handle_generic(object_type, str_object_id, api, attr_count, attr_list);
+    }
+}
+
+/*
+ * Writes asic view of single entry the same way consumer table does for
+ * regular operations, used for entries passed inside bulk or batch.
+ */
+void updateAsicView(
+        _In_ swss::RedisPipeline &pipeline,
+        _In_ const std::string &key,
+        _In_ bool remove,
+        _In_ const std::vector<swss::FieldValueTuple> &attributes)
+{
+    SWSS_LOG_ENTER();
+
+    std::string asicKey = "ASIC_STATE:" + key;
+
+    if (remove)
+    {
+        pipeline.del(asicKey);
+        return;
+    }
+
+    std::unordered_map<std::string, std::string> hash;
+
+    for (const auto &attr: attributes)
+    {
+        hash[fvField(attr)] = fvValue(attr);
+    }
+
+    if (hash.empty())
+    {
+        // make sure that object is in asic view even without attributes
+        hash["NULL"] = "NULL";
+    }
+
+    pipeline.hmset(asicKey, hash);
+}
+
+/*
+ * Bulk is single ASIC_STATE entry with key object_type:bulk:request_id
+ * and values serialized object id -> serialized bulk attributes. Entries
+ * are applied in order, failed entries don't stop remaining ones, and
+ * status of each entry is sent back with request id.
+ *
+ * Consumer table puts bulk entry to ASIC_STATE as regular hash, so asic
+ * view of each entry is written here and bulk hash is removed.
+ */
+sai_status_t processBulkEvent(
+        _In_ const swss::KeyOpFieldsValuesTuple &kco)
+{
     SWSS_LOG_ENTER();
 
-    swss::KeyOpFieldsValuesTuple kco;
-    consumer.pop(kco);
+    const std::string &key = kfvKey(kco);
+    const std::string &op = kfvOp(kco);
+
+    std::string str_object_type = key.substr(0, key.find(":"));
+    // request id is pid:counter, so it's everything after bulk marker
+    std::string requestId = key.substr(key.find(":bulk:") + strlen(":bulk:"));
+
+    sai_common_api_t api;
+
+    if (op == "bulkcreate")
+        api = SAI_COMMON_API_CREATE;
+    else if (op == "bulkremove")
+        api = SAI_COMMON_API_REMOVE;
+    else if (op == "bulkset")
+        api = SAI_COMMON_API_SET;
+    else
+    {
+        SWSS_LOG_ERROR("bulk api %s is not implemented", op.c_str());
+        exit(EXIT_FAILURE);
+    }
+
+    int index = 0;
+    sai_object_type_t object_type;
+    sai_deserialize_primitive(str_object_type, index, object_type);
+
+    if (object_type >= SAI_OBJECT_TYPE_MAX)
+    {
+        SWSS_LOG_ERROR("undefined object type %d", object_type);
+        exit(EXIT_FAILURE);
+    }
+
+    const std::vector<swss::FieldValueTuple> &values = kfvFieldsValues(kco);
+
+    SWSS_LOG_INFO("bulk %s of %zu entries, request %s", op.c_str(), values.size(), requestId.c_str());
+
+    std::vector<swss::FieldValueTuple> statuses;
+
+    swss::RedisPipeline pipeline(g_redisClient);
+
+    pipeline.del("ASIC_STATE:" + key);
+
+    sai_status_t status = SAI_STATUS_SUCCESS;
+
+    for (const auto &fvt: values)
+    {
+        std::string str_object_id = fvField(fvt);
+
+        auto attributes = SaiAttributeList::deserialize_bulk_attr_list(fvValue(fvt));
+
+        SaiAttributeList list(object_type, attributes, false);
+
+        translate_vid_to_rid_list(object_type, list.get_attr_count(), list.get_attr_list());
+
+        sai_status_t entryStatus = handle_api(object_type, str_object_id, api, list.get_attr_count(), list.get_attr_list());
+
+        std::string str_status;
+        sai_serialize_primitive(entryStatus, str_status);
+
+        statuses.push_back(swss::FieldValueTuple(str_object_id, str_status));
+
+        if (entryStatus != SAI_STATUS_SUCCESS)
+        {
+            SWSS_LOG_ERROR("failed to execute bulk api %s on %s:%s: %d", op.c_str(), str_object_type.c_str(), str_object_id.c_str(), entryStatus);
+
+            status = entryStatus;
+            continue;
+        }
+
+        updateAsicView(pipeline, str_object_type + ":" + str_object_id, api == SAI_COMMON_API_REMOVE, attributes);
+    }
+
+    pipeline.flush();
+
+    std::string str_status;
+    sai_serialize_primitive(status, str_status);
+
+    getResponse->send(requestId, str_status, statuses);
+
+    return status;
+}
+
+sai_status_t processSingleEvent(
+        _In_ const swss::KeyOpFieldsValuesTuple &kco)
+{
+    SWSS_LOG_ENTER();
 
     const std::string &key = kfvKey(kco);
     const std::string &op = kfvOp(kco);
 
+    if (op.compare(0, 4, "bulk") == 0)
+        return processBulkEvent(kco);
+
     std::string str_object_type = key.substr(0, key.find(":"));
     std::string str_object_id = key.substr(key.find(":")+1);
 
@@ -731,12 +866,10 @@ sai_status_t processEvent(swss::ConsumerTable &consumer)
         api = SAI_COMMON_API_REMOVE;
     else if (op == "set")
         api = SAI_COMMON_API_SET;
-    else if (op == "get")
-        api = SAI_COMMON_API_GET;
     else
     {
-        if (op != "delget")
-            SWSS_LOG_ERROR("api %s is not implemented", op.c_str());
+        // get requests are not passed by ASIC_STATE, see processGetRequest
+        SWSS_LOG_ERROR("api %s is not implemented", op.c_str());
 
         return SAI_STATUS_NOT_SUPPORTED;
     }
@@ -757,56 +890,532 @@ sai_status_t processEvent(swss::ConsumerTable &consumer)
 
     SaiAttributeList list(object_type, values, false);
 
-    if (api != SAI_COMMON_API_GET)
-        translate_vid_to_rid_list(object_type, list.get_attr_count(), list.get_attr_list());
+    translate_vid_to_rid_list(object_type, list.get_attr_count(), list.get_attr_list());
+
+    sai_status_t status = handle_api(object_type, str_object_id, api, list.get_attr_count(), list.get_attr_list());
+
+    if (status != SAI_STATUS_SUCCESS)
+    {
+        SWSS_LOG_ERROR("failed to execute api: %s: %d", op.c_str(), status);
+
+        exit(EXIT_FAILURE);
+    }
+
+    return status;
+}
+
+/*
+ * Get request is single message: op is request id, data is object key
+ * and values are attributes. Response is sent with the same request id,
+ * so sairedis can have many gets in flight.
+ */
+void processGetRequest(
+        _In_ swss::NotificationConsumer &consumer)
+{
+    std::lock_guard<std::mutex> lock(g_mutex);
+
+    SWSS_LOG_ENTER();
+
+    std::string requestId;
+    std::string key;
+    std::vector<swss::FieldValueTuple> values;
+
+    consumer.pop(requestId, key, values);
+
+    SWSS_LOG_INFO("get request %s key: %s", requestId.c_str(), key.c_str());
+
+    std::string str_object_type = key.substr(0, key.find(":"));
+    std::string str_object_id = key.substr(key.find(":")+1);
+
+    int index = 0;
+    sai_object_type_t object_type;
+    sai_deserialize_primitive(str_object_type, index, object_type);
+
+    if (object_type >= SAI_OBJECT_TYPE_MAX)
+    {
+        SWSS_LOG_ERROR("undefined object type %d", object_type);
+
+        internal_syncd_get_send(requestId, object_type, SAI_STATUS_NOT_SUPPORTED, 0, NULL);
+        return;
+    }
+
+    SaiAttributeList list(object_type, values, false);
 
     sai_attribute_t *attr_list = list.get_attr_list();
     uint32_t attr_count = list.get_attr_count();
 
-    sai_status_t status;
-    switch (object_type)
+    sai_status_t status = handle_api(object_type, str_object_id, SAI_COMMON_API_GET, attr_count, attr_list);
+
+    internal_syncd_get_send(requestId, object_type, status, attr_count, attr_list);
+
+    vidRidCacheFlush();
+}
+
+/*
+ * Batch is single ASIC_STATE entry with key batch:batch_id, op batch and
+ * values op:object_type:object_id -> serialized bulk attributes, sent by
+ * sairedis when asic state buffering is enabled. It's expanded back to
+ * single operations in the same order. Consumer table wrote only batch
+ * hash, so asic view of each operation is written here, before it's
+ * applied, same as consumer table does.
+ */
+void expandBatchEvent(
+        _In_ const swss::KeyOpFieldsValuesTuple &kco,
+        _In_ swss::RedisPipeline &pipeline,
+        _Inout_ std::vector<swss::KeyOpFieldsValuesTuple> &events)
+{
+    SWSS_LOG_ENTER();
+
+    const std::string &key = kfvKey(kco);
+
+    const std::vector<swss::FieldValueTuple> &values = kfvFieldsValues(kco);
+
+    SWSS_LOG_INFO("expanding %s of %zu operations", key.c_str(), values.size());
+
+    pipeline.del("ASIC_STATE:" + key);
+
+    for (const auto &fvt: values)
     {
-        case SAI_OBJECT_TYPE_FDB:
-            status = handle_fdb(str_object_id, api, attr_count, attr_list);
-            break;
+        const std::string &field = fvField(fvt);
 
-        case SAI_OBJECT_TYPE_SWITCH:
-            status = handle_switch(str_object_id, api, attr_count, attr_list);
-            break;
+        size_t pos = field.find(":");
 
-        case SAI_OBJECT_TYPE_NEIGHBOR:
-            status = handle_neighbor(str_object_id, api, attr_count, attr_list);
-            break;
+        if (pos == std::string::npos)
+        {
+            SWSS_LOG_ERROR("invalid batch entry %s", field.c_str());
+            exit(EXIT_FAILURE);
+        }
 
-        case SAI_OBJECT_TYPE_ROUTE:
-            status = handle_route(str_object_id, api, attr_count, attr_list);
-            break;
+        std::string op = field.substr(0, pos);
+        std::string entryKey = field.substr(pos + 1);
 
-        case SAI_OBJECT_TYPE_VLAN:
-            status = handle_vlan(str_object_id, api, attr_count, attr_list);
-            break;
+        auto attributes = SaiAttributeList::deserialize_bulk_attr_list(fvValue(fvt));
+
+        updateAsicView(pipeline, entryKey, op == "remove", attributes);
+
+        events.push_back(swss::KeyOpFieldsValuesTuple(entryKey, op, attributes));
+    }
+}
+
+/*
+ * Returns true when operation could depend on object with given
+ * serialized id, that is object id is part of its key or any of its
+ * attribute ids or values. Search is textual, so it can give false
+ * positive which only prevents cancellation.
+ *
+ * Bulk operation carries object ids in fields and packed attributes in
+ * values, so it's always treated as dependent.
+ */
+bool isDependentEvent(
+        _In_ const swss::KeyOpFieldsValuesTuple &kco,
+        _In_ const std::string &str_object_id)
+{
+    SWSS_LOG_ENTER();
+
+    if (kfvOp(kco).compare(0, 4, "bulk") == 0)
+        return true;
+
+    if (kfvKey(kco).find(str_object_id) != std::string::npos)
+        return true;
+
+    for (const auto &fvt: kfvFieldsValues(kco))
+    {
+        if (fvField(fvt).find(str_object_id) != std::string::npos)
+            return true;
+
+        const std::string &value = fvValue(fvt);
 
+        if (!sai_is_compact_value(value))
+        {
+            if (value.find(str_object_id) != std::string::npos)
+                return true;
+
+            continue;
+        }
+
+        std::string hex;
+
+        if (!sai_deserialize_compact_value(value, hex) || hex.find(str_object_id) != std::string::npos)
+            return true;
+    }
+
+    return false;
+}
+
+/*
+ * Number of set operations which were not applied since they were
+ * overwritten by later set of the same attribute in the same batch.
+ */
+uint64_t g_coalescedSets = 0;
+
+/*
+ * Returns true when attribute value can hold object ids, unknown
+ * attributes are treated as references.
+ */
+bool isObjectReferenceAttribute(
+        _In_ const std::string &key,
+        _In_ const std::string &str_attr_id)
+{
+    SWSS_LOG_ENTER();
+
+    std::string str_object_type = key.substr(0, key.find(":"));
+
+    int index = 0;
+    sai_object_type_t object_type;
+    sai_deserialize_primitive(str_object_type, index, object_type);
+
+    index = 0;
+    sai_attr_id_t attr_id;
+    sai_deserialize_primitive(str_attr_id, index, attr_id);
+
+    sai_attr_serialization_type_t serialization_type;
+
+    if (object_type >= SAI_OBJECT_TYPE_MAX ||
+            sai_get_serialization_type(object_type, attr_id, serialization_type) != SAI_STATUS_SUCCESS)
+        return true;
+
+    switch (serialization_type)
+    {
+        case SAI_SERIALIZATION_TYPE_OBJECT_ID:
+        case SAI_SERIALIZATION_TYPE_OBJECT_LIST:
+        case SAI_SERIALIZATION_TYPE_VLAN_PORT_LIST:
+        case SAI_SERIALIZATION_TYPE_ACL_FIELD_DATA_OBJECT_ID:
+        case SAI_SERIALIZATION_TYPE_ACL_FIELD_DATA_OBJECT_LIST:
+        case SAI_SERIALIZATION_TYPE_ACL_ACTION_DATA_OBJECT_ID:
+        case SAI_SERIALIZATION_TYPE_ACL_ACTION_DATA_OBJECT_LIST:
+            return true;
+
+        default:
+            return false;
+    }
+}
+
+/*
+ * Returns true when first of two sets of the same attribute can't be
+ * dropped because of create or remove between them:
+ *
+ * - create or remove of object referenced by value of any of the sets,
+ * - any remove when attribute holds object ids, since value before first
+ *   set is not known and could reference removed object (route pointing
+ *   to next hop group which is removed after route was set to other one).
+ */
+bool hasSetBarrier(
+        _In_ const std::vector<swss::KeyOpFieldsValuesTuple> &events,
+        _In_ size_t first,
+        _In_ size_t last)
+{
+    SWSS_LOG_ENTER();
+
+    const std::string &attr = fvField(kfvFieldsValues(events[first])[0]);
+
+    bool reference = isObjectReferenceAttribute(kfvKey(events[first]), attr);
+
+    for (size_t idx = first + 1; idx < last; idx++)
+    {
+        const auto &kco = events[idx];
+
+        const std::string &op = kfvOp(kco);
+
+        if (op != "create" && op != "remove")
+            continue;
+
+        if (op == "remove" && reference)
+            return true;
+
+        const std::string &key = kfvKey(kco);
+
+        std::string str_object_id = key.substr(key.find(":") + 1);
+
+        if (isDependentEvent(events[first], str_object_id) || isDependentEvent(events[last], str_object_id))
+            return true;
+    }
+
+    return false;
+}
+
+/*
+ * Removes sets which are immediately followed (looking only at operations
+ * on the same object) by set of the same attribute, only last value is
+ * applied. Create and remove of object are barriers, and so are creates
+ * and removes of referenced objects, see hasSetBarrier. Bulk operations
+ * carry many objects, so they are barriers for all objects. Get requests
+ * are not passed by ASIC_STATE, they are processed between batches, so
+ * batch never crosses a get. Asic view already contains last value, since
+ * it was written when entries were popped.
+ */
+size_t coalesceSetEvents(
+        _Inout_ std::vector<swss::KeyOpFieldsValuesTuple> &events)
+{
+    SWSS_LOG_ENTER();
+
+    // index of next set on object, missing when next operation on object
+    // is not single attribute set
+    std::unordered_map<std::string, size_t> nextSet;
+
+    std::vector<bool> skip(events.size(), false);
+
+    size_t coalesced = 0;
+
+    for (size_t idx = events.size(); idx-- > 0; )
+    {
+        const auto &kco = events[idx];
+
+        const std::string &key = kfvKey(kco);
+
+        const std::vector<swss::FieldValueTuple> &values = kfvFieldsValues(kco);
+
+        if (kfvOp(kco).compare(0, 4, "bulk") == 0)
+        {
+            nextSet.clear();
+            continue;
+        }
+
+        if (kfvOp(kco) != "set" || values.size() != 1)
+        {
+            nextSet.erase(key);
+            continue;
+        }
+
+        const std::string &attr = fvField(values[0]);
+
+        auto it = nextSet.find(key);
+
+        if (it != nextSet.end() &&
+                fvField(kfvFieldsValues(events[it->second])[0]) == attr &&
+                !hasSetBarrier(events, idx, it->second))
+        {
+            SWSS_LOG_DEBUG("coalescing set %s on %s", attr.c_str(), key.c_str());
+
+            skip[idx] = true;
+            coalesced++;
+            continue;
+        }
+
+        nextSet[key] = idx;
+    }
+
+    if (coalesced == 0)
+        return 0;
+
+    size_t pos = 0;
+
+    for (size_t idx = 0; idx < events.size(); idx++)
+    {
+        if (skip[idx])
+            continue;
+
+        if (pos != idx)
+            events[pos] = std::move(events[idx]);
+
+        pos++;
+    }
+
+    events.resize(pos);
+
+    g_coalescedSets += coalesced;
+
+    SWSS_LOG_INFO("coalesced %zu sets, total saved api calls: %llu", coalesced, (unsigned long long)g_coalescedSets);
+
+    return coalesced;
+}
+
+/*
+ * Number of create/remove pairs which were cancelled in batch, each pair
+ * saves two api calls.
+ */
+uint64_t g_cancelledPairs = 0;
+
+bool isCancellableObjectType(
+        _In_ sai_object_type_t object_type)
+{
+    SWSS_LOG_ENTER();
+
+    switch (object_type)
+    {
+        // referenced by ids other than object key (vlan id, neighbor ip)
+        // or not created by create api at all
+        case SAI_OBJECT_TYPE_FDB:
+        case SAI_OBJECT_TYPE_NEIGHBOR:
+        case SAI_OBJECT_TYPE_VLAN:
+        case SAI_OBJECT_TYPE_SWITCH:
         case SAI_OBJECT_TYPE_TRAP:
-            status = handle_trap(str_object_id, api, attr_count, attr_list);
-            break;
+            return false;
 
         default:
-            status = handle_generic(object_type, str_object_id, api, attr_count, attr_list);
-            break;
+            return object_type < SAI_OBJECT_TYPE_MAX;
     }
+}
 
-    if (api == SAI_COMMON_API_GET)
+/*
+ * Cancels create of object followed within window entries by its remove,
+ * when none of operations between them depends on the object. Neither
+ * create nor remove is applied, so no RID is created and VIDTORID and
+ * RIDTOVID don't change, asic view of object was already created and
+ * removed when entries were popped. Pairs are searched from the end, so
+ * nested pairs (next hop created and removed around route using it) are
+ * cancelled as well.
+ *
+ * Remove followed by create of the same key is not cancelled, created
+ * object can have different attributes than removed one and we don't
+ * know removed attributes at this point.
+ */
+size_t cancelCreateRemoveEvents(
+        _Inout_ std::vector<swss::KeyOpFieldsValuesTuple> &events,
+        _In_ size_t window)
+{
+    SWSS_LOG_ENTER();
+
+    std::vector<bool> skip(events.size(), false);
+
+    size_t cancelled = 0;
+
+    for (size_t idx = events.size(); idx-- > 0; )
     {
-        internal_syncd_get_send(object_type, status, attr_count, attr_list);
+        const auto &create = events[idx];
+
+        if (kfvOp(create) != "create")
+            continue;
+
+        const std::string &key = kfvKey(create);
+
+        std::string str_object_type = key.substr(0, key.find(":"));
+        std::string str_object_id = key.substr(key.find(":") + 1);
+
+        int index = 0;
+        sai_object_type_t object_type;
+        sai_deserialize_primitive(str_object_type, index, object_type);
+
+        if (!isCancellableObjectType(object_type))
+            continue;
+
+        size_t end = std::min(events.size(), idx + 1 + window);
+
+        for (size_t next = idx + 1; next < end; next++)
+        {
+            if (skip[next])
+                continue;
+
+            const auto &kco = events[next];
+
+            if (kfvOp(kco) == "remove" && kfvKey(kco) == key)
+            {
+                SWSS_LOG_DEBUG("cancelling create and remove of %s", key.c_str());
+
+                skip[idx] = true;
+                skip[next] = true;
+                cancelled++;
+                break;
+            }
+
+            if (isDependentEvent(kco, str_object_id))
+                break;
+        }
     }
-    else if (status != SAI_STATUS_SUCCESS)
+
+    if (cancelled == 0)
+        return 0;
+
+    size_t pos = 0;
+
+    for (size_t idx = 0; idx < events.size(); idx++)
     {
-        SWSS_LOG_ERROR("failed to execute api: %s: %d", op.c_str(), status);
+        if (skip[idx])
+            continue;
 
-        exit(EXIT_FAILURE);
+        if (pos != idx)
+            events[pos] = std::move(events[idx]);
+
+        pos++;
     }
 
-    return status;
+    events.resize(pos);
+
+    g_cancelledPairs += cancelled;
+
+    SWSS_LOG_INFO("cancelled %zu create/remove pairs, total saved api calls: %llu", cancelled, (unsigned long long)(2 * g_cancelledPairs));
+
+    return cancelled;
+}
+
+/*
+ * Drains up to batchSize pending entries from consumer under single lock
+ * acquisition and process them in order they were queued.
+ *
+ * Each entry pushed to consumer table is accompanied by single publish
+ * message, so we can't just pop until queue is empty, notification
+ * messages would be left behind and main select would wake up later
+ * for entries that were already processed. Instead we use private
+ * select on consumer with zero timeout, which consumes exactly one
+ * notification per popped entry.
+ */
+void processEventBatch(
+        _In_ swss::ConsumerTable &consumer,
+        _In_ size_t batchSize,
+        _In_ bool coalesceSets,
+        _In_ size_t cancelWindow)
+{
+    std::lock_guard<std::mutex> lock(g_mutex);
+
+    SWSS_LOG_ENTER();
+
+    std::vector<swss::KeyOpFieldsValuesTuple> batch;
+
+    batch.reserve(batchSize);
+
+    // first entry was already signaled by main select
+
+    batch.emplace_back();
+    consumer.pop(batch.back());
+
+    swss::Select s;
+
+    s.addSelectable(&consumer);
+
+    while (batch.size() < batchSize)
+    {
+        swss::Selectable *sel;
+
+        int fd;
+
+        int result = s.select(&sel, &fd, 0);
+
+        if (result != swss::Select::OBJECT)
+            break;
+
+        batch.emplace_back();
+        consumer.pop(batch.back());
+    }
+
+    std::vector<swss::KeyOpFieldsValuesTuple> events;
+
+    events.reserve(batch.size());
+
+    swss::RedisPipeline pipeline(g_redisClient);
+
+    for (auto &kco: batch)
+    {
+        if (kfvOp(kco) == "batch")
+            expandBatchEvent(kco, pipeline, events);
+        else
+            events.push_back(std::move(kco));
+    }
+
+    pipeline.flush();
+
+    if (cancelWindow)
+        cancelCreateRemoveEvents(events, cancelWindow);
+
+    if (coalesceSets)
+        coalesceSetEvents(events);
+
+    SWSS_LOG_INFO("processing batch of %zu entries", events.size());
+
+    for (const auto &kco: events)
+    {
+        processSingleEvent(kco);
+    }
+
+    vidRidCacheFlush();
 }
 
 swss::Logger::Priority redisGetLogLevel()
@@ -925,6 +1534,9 @@ struct cmdOptions
     bool warmStart;
     bool disableCountersThread;
     std::string profileMapFile;
+    size_t batchSize;
+    bool disableCoalesceSets;
+    size_t cancelWindow;
 };
 
 cmdOptions handleCmdLine(int argc, char **argv)
@@ -935,7 +1547,10 @@ cmdOptions handleCmdLine(int argc, char **argv)
 
     const int defaultCountersThreadIntervalInSeconds = 1;
 
+    const size_t defaultBatchSize = 128;
+
     options.countersThreadIntervalInSeconds = defaultCountersThreadIntervalInSeconds;
+    options.batchSize = defaultBatchSize;
 
     while(true)
     {
@@ -946,12 +1561,15 @@ cmdOptions handleCmdLine(int argc, char **argv)
             { "warmStart",        no_argument,       0, 'w' },
             { "profile",          required_argument, 0, 'p' },
             { "countersInterval", required_argument, 0, 'i' },
+            { "batchSize",        required_argument, 0, 'b' },
+            { "noCoalesce",       no_argument,       0, 'C' },
+            { "cancelWindow",     required_argument, 0, 'W' },
             { 0,                  0,                 0,  0  }
         };
 
         int option_index = 0;
 
-        int c = getopt_long(argc, argv, "dNwp:i:", long_options, &option_index);
+        int c = getopt_long(argc, argv, "dNwCp:i:b:W:", long_options, &option_index);
 
         if (c == -1)
             break;
@@ -993,6 +1611,35 @@ cmdOptions handleCmdLine(int argc, char **argv)
                     break;
                 }
 
+            case 'b':
+                {
+                    SWSS_LOG_NOTICE("asic state batch size: %s", optarg);
+
+                    int batchSize = std::stoi(std::string(optarg));
+
+                    // batch size 1 means process single entry per select
+                    options.batchSize = (size_t)std::max(1, batchSize);
+
+                    break;
+                }
+
+            case 'C':
+                SWSS_LOG_NOTICE("disable coalescing of sets");
+                options.disableCoalesceSets = true;
+                break;
+
+            case 'W':
+                {
+                    SWSS_LOG_NOTICE("create/remove cancel window: %s", optarg);
+
+                    int window = std::stoi(std::string(optarg));
+
+                    // zero window disables cancellation
+                    options.cancelWindow = (size_t)std::max(0, window);
+
+                    break;
+                }
+
             case 'w':
                 SWSS_LOG_NOTICE("warm start request");
                 options.warmStart = true;
@@ -1119,11 +1766,11 @@ int main(int argc, char **argv)
     swss::NotificationConsumer *notifySyncdQuery = new swss::NotificationConsumer(db, "NOTIFYSYNCDREQUERY");
     swss::NotificationConsumer *restartQuery = new swss::NotificationConsumer(db, "RESTARTQUERY");
 
-    // at the end we cant use producer consumer concept since
-    // if one proces will restart there may be something in the queue
-    // also "remove" from response queue will also trigger another "response"
-    getRequest = new swss::ConsumerTable(db, "GETREQUEST");
-    getResponse  = new swss::ProducerTable(db, "GETRESPONSE");
+    // get requests and responses are notifications, nothing is left in
+    // queue when one of processes restarts, and each message is matched
+    // by request id
+    getRequest = new swss::NotificationConsumer(db, "GETREQUEST");
+    getResponse  = new swss::NotificationProducer(db, "GETRESPONSE");
     notifications = new swss::NotificationProducer(dbNtf, "NOTIFICATIONS");
     notifySyncdResponse = new swss::NotificationProducer(db, "NOTIFYSYNCDRESPONSE");
 
@@ -1135,6 +1782,19 @@ int main(int argc, char **argv)
 
     g_veryFirstRun = isVeryFirstRun();
 
+    // let libsairedis know which attribute encodings we can decode
+
+    g_redisClient->hset(HIDDEN, ATTR_ENCODINGS_FIELD, ATTR_ENCODING_HEX " " ATTR_ENCODING_COMPACT_V1);
+
+    {
+        // must be loaded before switch initialize, since
+        // notifications can arrive right after that
+
+        std::lock_guard<std::mutex> lock(g_mutex);
+
+        vidRidCacheLoad();
+    }
+
     if (options.warmStart)
     {
         const char *warmBootReadFile = profile_get_value(0, SAI_KEY_WARM_BOOT_READ_FILE);
@@ -1231,9 +1891,18 @@ int main(int argc, char **argv)
                 continue;
             }
 
-            if (result == swss::Select::OBJECT)
+            if (sel == getRequest)
             {
-                processEvent(*(swss::ConsumerTable*)sel);
+                processGetRequest(*getRequest);
+                continue;
+            }
+
+            if (result != swss::Select::OBJECT)
+                continue;
+
+            if (sel == asicState)
+            {
+                processEventBatch(*asicState, options.batchSize, !options.disableCoalesceSets, options.cancelWindow);
             }
         }
     }
@@ -1246,6 +1915,12 @@ int main(int argc, char **argv)
 
     endCountersThread();
 
+    {
+        std::lock_guard<std::mutex> lock(g_mutex);
+
+        vidRidCacheFlush();
+    }
+
     if (warmRestartHint)
     {
         const char *warmBootWriteFile = profile_get_value(0, SAI_KEY_WARM_BOOT_WRITE_FILE);
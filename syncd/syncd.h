@@ -41,6 +41,16 @@ extern "C" {
 #define HIDDEN                      "HIDDEN"
 #define DEFAULT_VIRTUAL_ROUTER_ID   "DEFAULT_VIRTUAL_ROUTER_ID"
 #define CPU_PORT_ID                 "CPU_PORT_ID"
+#define ASIC_STATE_PATTERN          "ASIC_STATE:*"
+
+// number of keys requested by single SCAN when loading ASIC state
+#define ASIC_STATE_SCAN_COUNT       1000
+
+/*
+ * Number of threads used to create independent objects during hard reinit.
+ * Set to value greater than 1 only when vendor SAI is thread safe.
+ */
+#define SYNCD_KEY_HARD_REINIT_THREADS   "SYNCD_HARD_REINIT_THREADS"
 
 #define NOTIFY_SAI_INIT_VIEW        "SAI_INIT_VIEW"
 #define NOTIFY_SAI_APPLY_VIEW       "SAI_APPLY_VIEW"
@@ -48,6 +58,7 @@ extern "C" {
 extern std::mutex g_mutex;
 
 void onSyncdStart(bool warmStart);
+
 void hardReinit();
 
 sai_object_id_t replaceVidToRid(const sai_object_id_t &virtual_object_id);
@@ -58,8 +69,8 @@ sai_object_id_t redisGetDefaultVirtualRouterId();
 void redisClearVidToRidMap();
 void redisClearRidToVidMap();
 
-extern swss::ConsumerTable         *getRequest;
-extern swss::ProducerTable         *getResponse;
+extern swss::NotificationConsumer  *getRequest;
+extern swss::NotificationProducer  *getResponse;
 extern swss::NotificationProducer  *notifications;
 
 extern swss::RedisClient   *g_redisClient;
@@ -145,14 +156,54 @@ extern sai_switch_notification_t switch_notifications;
 
 extern swss::DBConnector *db;
 
+const char* profile_get_value(
+        _In_ sai_switch_profile_id_t profile_id,
+        _In_ const char* variable);
+
 void initialize_common_api_pointers();
 void populate_sai_apis();
 
 void startCountersThread(int intervalInSeconds);
 void endCountersThread();
+void invalidatePortCountersSnapshot();
+void invalidatePortCountersCapabilities(
+        _In_ sai_object_id_t portRid);
+void updatePortCountersOperStatus(
+        _In_ sai_object_id_t portRid,
+        _In_ sai_port_oper_status_t status);
 
 std::unordered_map<sai_uint32_t, sai_object_id_t> redisGetLaneMap();
 
-std::vector<sai_object_id_t> saiGetPortList();
+const std::vector<sai_object_id_t>& saiGetPortList();
+void saiInvalidatePortList();
+
+void vidRidCacheLoad();
+
+void vidRidCacheReset(
+        _In_ const std::unordered_map<sai_object_id_t, sai_object_id_t> &vidToRidMap);
+
+bool vidRidCacheGetRid(
+        _In_ sai_object_id_t vid,
+        _Out_ sai_object_id_t &rid);
+
+bool vidRidCacheGetVid(
+        _In_ sai_object_id_t rid,
+        _Out_ sai_object_id_t &vid);
+
+void vidRidCacheInsert(
+        _In_ sai_object_id_t vid,
+        _In_ sai_object_id_t rid);
+
+void vidRidCacheRemove(
+        _In_ sai_object_id_t vid,
+        _In_ sai_object_id_t rid);
+
+void vidRidCacheFlush();
+
+uint64_t vidRidCacheGetGeneration(
+        _In_ sai_object_type_t objectType);
+
+std::vector<std::pair<sai_object_id_t, sai_object_id_t>> vidRidCacheGetObjects(
+        _In_ sai_object_type_t objectType);
 
 #endif // __SYNCD_H__
@@ -1,85 +1,1763 @@
 #include "syncd.h"
+#include "countersring.h"
 #include <condition_variable>
+#include <functional>
+#include <atomic>
+#include <algorithm>
+#include <unordered_set>
+#include <cmath>
 
-void collectCounters(swss::Table &countersTable,
-                     const std::vector<sai_port_stat_counter_t> &supportedCounters)
+/*
+ * Counters are collected by counter groups. Each group defines object type,
+ * statistics which will be probed on each object of that type, function
+ * which reads statistics and polling interval. All groups are run by single
+ * scheduler in counters thread, each one on its own interval.
+ *
+ * Counters thread don't take g_mutex during collection. Each group works on
+ * immutable snapshot of its objects, and snapshot is rebuilt (under g_mutex)
+ * only when objects of that type changed.
+ */
+
+typedef sai_status_t (*get_stats_fn)(
+        _In_ sai_object_id_t objectId,
+        _In_ const int32_t *counterIds,
+        _In_ uint32_t count,
+        _Out_ uint64_t *counters);
+
+struct CounterStat
+{
+    int32_t id;
+    std::string name;
+};
+
+/*
+ * Rate computed from sum of source statistics, like bits per second from
+ * octets. Rate is smoothed using EWMA and published next to raw counters.
+ */
+struct CounterRate
+{
+    std::string name;
+
+    std::vector<int32_t> sources;
+
+    uint64_t multiplier;
+};
+
+struct CounterGroup
+{
+    std::string name;
+
+    sai_object_type_t objectType;
+
+    std::vector<CounterStat> stats;
+
+    std::vector<CounterRate> rates;
+
+    // EWMA time constant in seconds, 0 disables smoothing
+    double rateTau;
+
+    get_stats_fn getStats;
+
+    // 0 means group is disabled
+    uint32_t intervalMs;
+
+    // when greater than intervalMs, objects without counter changes are
+    // polled less often, up to this interval
+    uint32_t maxIntervalMs;
+
+    // when set, counters are written to shared memory ring instead of redis
+    std::string ringFile;
+    uint32_t ringSlots;
+    uint32_t ringMaxObjects;
+};
+
+static std::vector<CounterGroup> g_counterGroups;
+
+void registerCounterGroup(
+        _In_ const CounterGroup &group)
+{
+    SWSS_LOG_ENTER();
+
+    if (group.getStats == NULL || group.intervalMs == 0)
+    {
+        SWSS_LOG_NOTICE("counter group %s is disabled", group.name.c_str());
+        return;
+    }
+
+    SWSS_LOG_NOTICE("registered counter group %s, stats: %zu, interval: %u ms, max interval: %u ms",
+            group.name.c_str(),
+            group.stats.size(),
+            group.intervalMs,
+            std::max(group.intervalMs, group.maxIntervalMs));
+
+    g_counterGroups.push_back(group);
+}
+
+/*
+ * Objects of counter group. Ports are taken from switch port list, other
+ * object types from VID/RID map, so only objects which are known to
+ * orchagent are polled.
+ */
+struct CounterObjectsSnapshot
+{
+    std::vector<sai_object_id_t> rids;
+
+    std::vector<std::string> vids; // serialized
+
+    std::vector<sai_object_id_t> rawVids;
+};
+
+static std::atomic<uint64_t> g_portsGeneration(0);
+
+void invalidatePortCountersSnapshot()
+{
+    SWSS_LOG_ENTER();
+
+    SWSS_LOG_INFO("ports changed, port counters snapshot will be rebuilt");
+
+    g_portsGeneration++;
+}
+
+/*
+ * Oper status of ports, reported by port state change notifications. Down
+ * ports are polled at max interval of group, ports which changed state are
+ * polled immediately.
+ */
+static std::mutex g_portOperStatusMutex;
+static std::unordered_map<sai_object_id_t, sai_port_oper_status_t> g_portOperStatus;
+static std::atomic<uint64_t> g_portOperStatusGeneration(0);
+
+void updatePortCountersOperStatus(
+        _In_ sai_object_id_t portRid,
+        _In_ sai_port_oper_status_t status)
+{
+    SWSS_LOG_ENTER();
+
+    std::lock_guard<std::mutex> lock(g_portOperStatusMutex);
+
+    g_portOperStatus[portRid] = status;
+
+    g_portOperStatusGeneration++;
+}
+
+/*
+ * Vendor SAI can reuse RID of removed port for new one (breakout), so
+ * supported counters cached by RID must be probed again. Epoch counter is
+ * bumped on each invalidation, and invalidation epoch is kept per port and
+ * for all ports. Cached counters probed before invalidation of their port
+ * are probed again on next snapshot rebuild.
+ */
+static std::mutex g_portCapabilitiesMutex;
+static uint64_t g_capabilitiesEpoch = 0;
+static uint64_t g_allPortsCapabilitiesEpoch = 0;
+static std::unordered_map<sai_object_id_t, uint64_t> g_portCapabilitiesEpoch;
+
+void invalidatePortCountersCapabilities(
+        _In_ sai_object_id_t portRid)
+{
+    SWSS_LOG_ENTER();
+
+    {
+        std::lock_guard<std::mutex> lock(g_portCapabilitiesMutex);
+
+        g_capabilitiesEpoch++;
+
+        if (portRid == SAI_NULL_OBJECT_ID)
+            g_allPortsCapabilitiesEpoch = g_capabilitiesEpoch;
+        else
+            g_portCapabilitiesEpoch[portRid] = g_capabilitiesEpoch;
+    }
+
+    SWSS_LOG_INFO("port RID %llx counters capabilities invalidated", portRid);
+
+    invalidatePortCountersSnapshot();
+}
+
+uint64_t getCountersCapabilitiesEpoch()
+{
+    SWSS_LOG_ENTER();
+
+    std::lock_guard<std::mutex> lock(g_portCapabilitiesMutex);
+
+    return g_capabilitiesEpoch;
+}
+
+/*
+ * Returns true when supported counters of object probed in given epoch
+ * are no longer valid.
+ */
+bool isCountersCapabilitiesStale(
+        _In_ sai_object_type_t objectType,
+        _In_ sai_object_id_t rid,
+        _In_ uint64_t epoch)
+{
+    SWSS_LOG_ENTER();
+
+    if (objectType != SAI_OBJECT_TYPE_PORT)
+        return false;
+
+    std::lock_guard<std::mutex> lock(g_portCapabilitiesMutex);
+
+    if (g_allPortsCapabilitiesEpoch > epoch)
+        return true;
+
+    auto it = g_portCapabilitiesEpoch.find(rid);
+
+    return it != g_portCapabilitiesEpoch.end() && it->second > epoch;
+}
+
+uint64_t getCounterObjectsGeneration(
+        _In_ sai_object_type_t objectType)
+{
+    if (objectType == SAI_OBJECT_TYPE_PORT)
+        return g_portsGeneration;
+
+    return vidRidCacheGetGeneration(objectType);
+}
+
+std::shared_ptr<const CounterObjectsSnapshot> buildCounterObjectsSnapshot(
+        _In_ const CounterGroup &group)
 {
-    // collect counters should be under mutex
-    // sice configuration can change and we
-    // don't want that during counters collection
     std::lock_guard<std::mutex> lock(g_mutex);
 
-    SWSS_LOG_ENTER();
+    SWSS_LOG_ENTER();
+
+    auto snapshot = std::make_shared<CounterObjectsSnapshot>();
+
+    if (group.objectType == SAI_OBJECT_TYPE_PORT)
+    {
+        snapshot->rids = saiGetPortList();
+
+        for (auto &portId: snapshot->rids)
+        {
+            sai_object_id_t vid = translate_rid_to_vid(portId);
+
+            std::string strPortId;
+            sai_serialize_primitive(vid, strPortId);
+
+            snapshot->vids.push_back(strPortId);
+            snapshot->rawVids.push_back(vid);
+        }
+
+        vidRidCacheFlush();
+    }
+    else
+    {
+        for (const auto &kv: vidRidCacheGetObjects(group.objectType))
+        {
+            std::string strVid;
+            sai_serialize_primitive(kv.first, strVid);
+
+            snapshot->vids.push_back(strVid);
+            snapshot->rawVids.push_back(kv.first);
+            snapshot->rids.push_back(kv.second);
+        }
+    }
+
+    SWSS_LOG_NOTICE("counter group %s snapshot rebuilt, objects: %zu", group.name.c_str(), snapshot->rids.size());
+
+    return snapshot;
+}
+
+static const char g_digitPairs[] =
+    "00010203040506070809"
+    "10111213141516171819"
+    "20212223242526272829"
+    "30313233343536373839"
+    "40414243444546474849"
+    "50515253545556575859"
+    "60616263646566676869"
+    "70717273747576777879"
+    "80818283848586878889"
+    "90919293949596979899";
+
+/*
+ * Formats value as decimal into buffer of at least 20 characters, returns
+ * pointer to first digit, last digit is at buffer + 20 - 1.
+ */
+static const char* formatUint64(
+        _In_ uint64_t value,
+        _Out_ char *buffer)
+{
+    char *p = buffer + 20;
+
+    while (value >= 100)
+    {
+        uint64_t pair = (value % 100) * 2;
+
+        value /= 100;
+
+        *--p = g_digitPairs[pair + 1];
+        *--p = g_digitPairs[pair];
+    }
+
+    if (value < 10)
+    {
+        *--p = (char)('0' + value);
+    }
+    else
+    {
+        *--p = g_digitPairs[value * 2 + 1];
+        *--p = g_digitPairs[value * 2];
+    }
+
+    return p;
+}
+
+static void appendBulkString(
+        _Inout_ std::string &command,
+        _In_ const char *data,
+        _In_ size_t length)
+{
+    char buffer[20];
+
+    const char *len = formatUint64(length, buffer);
+
+    command += '$';
+    command.append(len, buffer + 20 - len);
+    command += "\r\n";
+    command.append(data, length);
+    command += "\r\n";
+}
+
+/*
+ * Supported statistics of single object, ids are passed to SAI, indexes
+ * point to group stats.
+ */
+struct SupportedCounters
+{
+    std::vector<int32_t> ids;
+
+    std::vector<size_t> indexes;
+
+    // capabilities epoch in which counters were probed
+    uint64_t epoch;
+};
+
+/*
+ * Rate state of single object, positions point to supported counters.
+ */
+struct RateState
+{
+    std::vector<size_t> positions;
+
+    size_t fieldIndex;
+
+    uint64_t multiplier;
+
+    uint64_t lastSum;
+
+    std::chrono::steady_clock::time_point lastTime;
+
+    double value;
+
+    bool hasLast;
+
+    bool initialized;
+};
+
+SupportedCounters getSupportedCounters(
+        _In_ const CounterGroup &group,
+        _In_ sai_object_id_t objectId)
+{
+    SWSS_LOG_ENTER();
+
+    SupportedCounters supported;
+
+    supported.epoch = 0;
+
+    for (size_t idx = 0; idx < group.stats.size(); idx++)
+    {
+        const CounterStat &stat = group.stats[idx];
+
+        uint64_t value;
+
+        sai_status_t status = group.getStats(objectId, &stat.id, 1, &value);
+
+        if (status != SAI_STATUS_SUCCESS)
+        {
+            SWSS_LOG_INFO("counter %s is not supported on RID %llx: %d", stat.name.c_str(), objectId, status);
+            continue;
+        }
+
+        supported.ids.push_back(stat.id);
+        supported.indexes.push_back(idx);
+    }
+
+    return supported;
+}
+
+/*
+ * Number of workers collecting counters can be set in profile using key
+ * SYNCD_COUNTERS_WORKERS, set value greater than 1 only when vendor SAI
+ * allows concurrent stats reads.
+ */
+size_t getCountersWorkersCount()
+{
+    SWSS_LOG_ENTER();
+
+    const char *value = profile_get_value(0, "SYNCD_COUNTERS_WORKERS");
+
+    if (value == NULL)
+        return 1;
+
+    int workers = atoi(value);
+
+    if (workers < 1)
+    {
+        SWSS_LOG_WARN("invalid counters workers count %s, using 1", value);
+
+        return 1;
+    }
+
+    return (size_t)workers;
+}
+
+/*
+ * Counters worker, objects of each group are sharded across workers. Each
+ * worker have its own redis connection, pipeline and buffers, so workers
+ * don't share anything during collection.
+ *
+ * Worker thread is started once with counters thread, and each cycle is
+ * handed to it as job, so no threads are created during collection.
+ */
+struct CountersWorker
+{
+    CountersWorker():
+        db(COUNTERS_DB, "localhost", 6379, 0),
+        client(&db),
+        pipeline(&client),
+        stopping(false)
+    {
+    }
+
+    ~CountersWorker()
+    {
+        stop();
+    }
+
+    void start()
+    {
+        thread = std::thread(&CountersWorker::run, this);
+    }
+
+    /*
+     * Must be called when worker is idle.
+     */
+    void stop()
+    {
+        if (!thread.joinable())
+            return;
+
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+
+            stopping = true;
+        }
+
+        cv.notify_all();
+
+        thread.join();
+    }
+
+    void post(
+            _In_ const std::function<void()> &work)
+    {
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+
+            job = work;
+        }
+
+        cv.notify_all();
+    }
+
+    void wait()
+    {
+        std::unique_lock<std::mutex> lock(mutex);
+
+        cv.wait(lock, [this] { return !job; });
+    }
+
+    void run()
+    {
+        std::unique_lock<std::mutex> lock(mutex);
+
+        while (true)
+        {
+            cv.wait(lock, [this] { return stopping || job; });
+
+            if (stopping)
+                return;
+
+            lock.unlock();
+
+            job();
+
+            lock.lock();
+
+            job = nullptr;
+
+            cv.notify_all();
+        }
+    }
+
+    swss::DBConnector db;
+    swss::RedisClient client;
+    swss::RedisPipeline pipeline;
+
+    std::string command;
+
+    std::vector<uint64_t> counters;
+
+    // statistics of last cycle
+    size_t polled;
+    double slowestMs;
+    sai_object_id_t slowestObject;
+
+    std::thread thread;
+
+    std::mutex mutex;
+    std::condition_variable cv;
+
+    std::function<void()> job;
+
+    bool stopping;
+};
+
+/*
+ * Runs work(index) on first count workers and waits until all are done.
+ */
+void runOnCountersWorkers(
+        _In_ std::vector<std::shared_ptr<CountersWorker>> &workers,
+        _In_ size_t count,
+        _In_ const std::function<void(size_t)> &work)
+{
+    SWSS_LOG_ENTER();
+
+    for (size_t i = 0; i < count; i++)
+    {
+        workers[i]->post([&work, i] { work(i); });
+    }
+
+    for (size_t i = 0; i < count; i++)
+    {
+        workers[i]->wait();
+    }
+}
+
+/*
+ * Probes supported counters on each of given objects. Objects can differ
+ * (like breakout or mixed speed ports), so each object is probed. Probing
+ * single object makes call per counter, so objects are probed in parallel
+ * on counters workers, since concurrent stats reads are allowed only when
+ * workers count was raised.
+ */
+std::vector<SupportedCounters> probeSupportedCounters(
+        _In_ const CounterGroup &group,
+        _In_ const std::vector<sai_object_id_t> &objects,
+        _In_ std::vector<std::shared_ptr<CountersWorker>> &workers)
+{
+    SWSS_LOG_ENTER();
+
+    SWSS_LOG_TIMER("probe supported counters");
+
+    std::vector<SupportedCounters> supported(objects.size());
+
+    size_t threads = std::min(workers.size(), objects.size());
+
+    std::atomic<size_t> index(0);
+
+    auto probe = [&](size_t) {
+
+        for (size_t idx = index++; idx < objects.size(); idx = index++)
+        {
+            supported[idx] = getSupportedCounters(group, objects[idx]);
+        }
+    };
+
+    if (threads <= 1)
+        probe(0);
+    else
+        runOnCountersWorkers(workers, threads, probe);
+
+    for (size_t i = 0; i < objects.size(); i++)
+    {
+        SWSS_LOG_INFO("%s RID %llx supports %zu counters", group.name.c_str(), objects[i], supported[i].ids.size());
+    }
+
+    return supported;
+}
+
+/*
+ * Every that many min intervals of group all counters of object are
+ * written, even those which didn't change, so COUNTERS_DB will recover if
+ * it was modified externally.
+ */
+#define COUNTERS_FULL_REFRESH_CYCLES 30
+
+/*
+ * Writer of shared memory counters ring, see countersring.h for layout.
+ * Each sample is one collection cycle of group. Records of single sample
+ * can be written by multiple workers, each one writes different records.
+ */
+class CountersRingWriter
+{
+    public:
+
+        CountersRingWriter():
+            m_base(NULL),
+            m_size(0),
+            m_sequence(0),
+            m_slot(NULL)
+        {
+        }
+
+        ~CountersRingWriter()
+        {
+            if (m_base)
+                munmap(m_base, m_size);
+        }
+
+        bool open(
+                _In_ const std::string &path,
+                _In_ uint32_t slots,
+                _In_ uint32_t maxObjects,
+                _In_ const std::vector<int32_t> &counterIds)
+        {
+            SWSS_LOG_ENTER();
+
+            // readers may still have old file mapped, so new file is
+            // created instead of truncating old one
+
+            unlink(path.c_str());
+
+            int fd = ::open(path.c_str(), O_RDWR | O_CREAT | O_TRUNC, 0644);
+
+            if (fd < 0)
+            {
+                SWSS_LOG_ERROR("failed to create counters ring %s: %s", path.c_str(), strerror(errno));
+                return false;
+            }
+
+            uint32_t maxCounters = (uint32_t)counterIds.size();
+
+            m_size = counters_ring_file_size(slots, maxObjects, maxCounters);
+
+            if (ftruncate(fd, m_size) != 0)
+            {
+                SWSS_LOG_ERROR("failed to resize counters ring %s to %zu: %s", path.c_str(), m_size, strerror(errno));
+                ::close(fd);
+                return false;
+            }
+
+            void *base = mmap(NULL, m_size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+
+            ::close(fd);
+
+            if (base == MAP_FAILED)
+            {
+                SWSS_LOG_ERROR("failed to map counters ring %s: %s", path.c_str(), strerror(errno));
+                return false;
+            }
+
+            m_base = (uint8_t*)base;
+
+            // file is zero filled, so all slot sequences are 0
+
+            counters_ring_header_t *h = header();
+
+            h->version = COUNTERS_RING_VERSION;
+            h->slots = slots;
+            h->max_objects = maxObjects;
+            h->max_counters = maxCounters;
+            h->record_size = counters_ring_record_size(maxCounters);
+            h->slot_size = counters_ring_slot_size(maxObjects, maxCounters);
+            h->ids_offset = counters_ring_ids_offset();
+            h->slots_offset = counters_ring_slots_offset(maxCounters);
+
+            memcpy(m_base + h->ids_offset, counterIds.data(), maxCounters * sizeof(int32_t));
+
+            h->last_sequence.store(0, std::memory_order_relaxed);
+            h->magic.store(COUNTERS_RING_MAGIC, std::memory_order_release);
+
+            SWSS_LOG_NOTICE("counters ring %s created, slots: %u, objects: %u, counters: %u, size: %zu",
+                    path.c_str(), slots, maxObjects, maxCounters, m_size);
+
+            return true;
+        }
+
+        uint32_t maxObjects() const
+        {
+            return header()->max_objects;
+        }
+
+        void beginSample(
+                _In_ uint32_t objectCount)
+        {
+            counters_ring_header_t *h = header();
+
+            m_sequence++;
+
+            m_slot = m_base + h->slots_offset + ((m_sequence - 1) % h->slots) * h->slot_size;
+
+            counters_ring_slot_header_t *sh = (counters_ring_slot_header_t*)m_slot;
+
+            // odd sequence marks slot as being written, fence keeps data
+            // writes after it
+
+            sh->seq.store(2 * m_sequence - 1, std::memory_order_relaxed);
+
+            std::atomic_thread_fence(std::memory_order_release);
+
+            struct timespec ts;
+
+            clock_gettime(CLOCK_REALTIME, &ts);
+
+            sh->timestamp_ns = (uint64_t)ts.tv_sec * 1000000000ULL + ts.tv_nsec;
+            sh->object_count = std::min(objectCount, h->max_objects);
+        }
+
+        /*
+         * Writes record of object, counters are ordered as supported ids,
+         * NULL counters means object was not collected in this sample.
+         */
+        void writeRecord(
+                _In_ size_t objectIndex,
+                _In_ sai_object_id_t vid,
+                _In_ const SupportedCounters &supported,
+                _In_ const uint64_t *counters)
+        {
+            const counters_ring_header_t *h = header();
+
+            if (objectIndex >= h->max_objects)
+                return;
+
+            uint64_t *record = (uint64_t*)(m_slot + sizeof(counters_ring_slot_header_t) + objectIndex * h->record_size);
+
+            record[0] = vid;
+
+            uint64_t *values = record + 1;
+
+            std::fill(values, values + h->max_counters, COUNTERS_RING_INVALID_VALUE);
+
+            if (counters == NULL)
+                return;
+
+            for (size_t idx = 0; idx < supported.indexes.size(); idx++)
+            {
+                values[supported.indexes[idx]] = counters[idx];
+            }
+        }
+
+        void endSample()
+        {
+            counters_ring_slot_header_t *sh = (counters_ring_slot_header_t*)m_slot;
+
+            sh->seq.store(2 * m_sequence, std::memory_order_release);
+
+            header()->last_sequence.store(m_sequence, std::memory_order_release);
+        }
+
+    private:
+
+        CountersRingWriter(const CountersRingWriter&);
+        CountersRingWriter& operator=(const CountersRingWriter&);
+
+        counters_ring_header_t* header() const
+        {
+            return (counters_ring_header_t*)m_base;
+        }
+
+        uint8_t *m_base;
+
+        size_t m_size;
+
+        uint64_t m_sequence;
+
+        uint8_t *m_slot;
+};
+
+/*
+ * Polling schedule of single object, interval and next run are used only
+ * in adaptive group.
+ */
+struct ObjectSchedule
+{
+    uint32_t intervalMs;
+
+    std::chrono::steady_clock::time_point nextRun;
+
+    // when all counters of object were last written
+    std::chrono::steady_clock::time_point lastFullWrite;
+};
+
+/*
+ * Collection state of single counter group. Writes counters of all objects
+ * as HMSET commands to pipeline.
+ *
+ * Only counters which changed since previous cycle are written, objects
+ * without changes are skipped. All counters of object are written when
+ * its last full write is older than COUNTERS_FULL_REFRESH_CYCLES min
+ * intervals, this is tracked per object, since in adaptive group objects
+ * are not polled in every cycle.
+ *
+ * Field names and per object command headers are formatted in redis
+ * protocol once (headers again only when snapshot changes), and commands
+ * are built in reused buffers, so steady state cycle don't allocate.
+ *
+ * Supported counters are probed once per object and cached by RID, until
+ * object is removed or port capabilities are invalidated.
+ *
+ * In adaptive group, scheduler runs group on its min interval, but each
+ * object is polled on its own interval. Interval is doubled (up to max)
+ * each time object counters didn't change, and returns to min when they
+ * change. Oper down ports are polled on max interval.
+ */
+struct CounterGroupWriter
+{
+    CounterGroupWriter(
+            _In_ const CounterGroup &group,
+            _In_ swss::Table &table):
+        group(group),
+        table(table),
+        generation(0),
+        adaptive(group.maxIntervalMs > group.intervalMs),
+        operStatusGeneration(0)
+    {
+        for (const auto &stat: group.stats)
+        {
+            std::string field;
+
+            appendBulkString(field, stat.name.data(), stat.name.size());
+
+            fields.push_back(field);
+        }
+
+        // rate fields are placed after stats fields
+
+        for (const auto &rate: group.rates)
+        {
+            std::string field;
+
+            appendBulkString(field, rate.name.data(), rate.name.size());
+
+            fields.push_back(field);
+        }
+
+        if (group.ringFile.size())
+        {
+            std::vector<int32_t> counterIds;
+
+            for (const auto &stat: group.stats)
+            {
+                counterIds.push_back(stat.id);
+            }
+
+            ring = std::make_shared<CountersRingWriter>();
+
+            if (!ring->open(group.ringFile, group.ringSlots, group.ringMaxObjects, counterIds))
+            {
+                SWSS_LOG_ERROR("failed to open counters ring of group %s, exiting", group.name.c_str());
+                exit(EXIT_FAILURE);
+            }
+        }
+    }
+
+    std::vector<RateState> createRates(
+            _In_ const SupportedCounters &supported)
+    {
+        std::vector<RateState> rates;
+
+        for (size_t r = 0; r < group.rates.size(); r++)
+        {
+            const CounterRate &rate = group.rates[r];
+
+            RateState state;
+
+            state.fieldIndex = group.stats.size() + r;
+            state.multiplier = rate.multiplier;
+            state.lastSum = 0;
+            state.value = 0;
+            state.hasLast = false;
+            state.initialized = false;
+
+            for (auto source: rate.sources)
+            {
+                auto it = std::find(supported.ids.begin(), supported.ids.end(), source);
+
+                if (it != supported.ids.end())
+                    state.positions.push_back(it - supported.ids.begin());
+            }
+
+            // rate is computed only when all sources are supported
+
+            if (state.positions.size() == rate.sources.size())
+                rates.push_back(state);
+        }
+
+        return rates;
+    }
+
+    void updateObjects(
+            _In_ std::vector<std::shared_ptr<CountersWorker>> &workers)
+    {
+        // read generation before snapshot, so change during rebuild
+        // will cause another rebuild
+
+        uint64_t current = getCounterObjectsGeneration(group.objectType);
+
+        if (snapshot && current == generation)
+            return;
+
+        generation = current;
+
+        snapshot = buildCounterObjectsSnapshot(group);
+
+        // drop objects which are gone, their RID can be reused later
+
+        std::unordered_set<sai_object_id_t> rids(snapshot->rids.begin(), snapshot->rids.end());
+
+        for (auto it = supportedCache.begin(); it != supportedCache.end(); )
+        {
+            if (rids.find(it->first) == rids.end())
+                it = supportedCache.erase(it);
+            else
+                ++it;
+        }
+
+        // probe only objects which were not seen before or which were
+        // removed and added again since they were probed
+
+        uint64_t epoch = getCountersCapabilitiesEpoch();
+
+        std::vector<sai_object_id_t> newObjects;
+
+        for (auto rid: snapshot->rids)
+        {
+            auto it = supportedCache.find(rid);
+
+            if (it == supportedCache.end() || isCountersCapabilitiesStale(group.objectType, rid, it->second.epoch))
+                newObjects.push_back(rid);
+        }
+
+        if (newObjects.size())
+        {
+            auto supported = probeSupportedCounters(group, newObjects, workers);
+
+            for (size_t i = 0; i < newObjects.size(); i++)
+            {
+                supported[i].epoch = epoch;
+
+                supportedCache[newObjects[i]] = supported[i];
+            }
+        }
+
+        headers.clear();
+        objectCounters.clear();
+        objectFields.clear();
+        objectRates.clear();
+
+        for (size_t i = 0; i < snapshot->rids.size(); i++)
+        {
+            const std::string &key = table.getKeyName(snapshot->vids[i]);
+
+            // argument count depends on number of changed fields
+            // so it's added when command is queued
+
+            std::string header;
+
+            appendBulkString(header, "HMSET", 5);
+            appendBulkString(header, key.data(), key.size());
+
+            headers.push_back(header);
+
+            const SupportedCounters &supported = supportedCache[snapshot->rids[i]];
+
+            objectCounters.push_back(supported);
+
+            objectRates.push_back(createRates(supported));
+
+            std::vector<size_t> indexes = supported.indexes;
+
+            for (const auto &rate: objectRates.back())
+            {
+                indexes.push_back(rate.fieldIndex);
+            }
+
+            objectFields.push_back(indexes);
+        }
+
+        // object indexes changed, previous values are no longer valid
+
+        previous.assign(headers.size(), std::vector<uint64_t>());
+
+        // all objects are polled in first cycle after snapshot change
+
+        schedules.assign(headers.size(), ObjectSchedule {
+                group.intervalMs,
+                std::chrono::steady_clock::time_point(),
+                std::chrono::steady_clock::time_point() });
+
+        if (ring && snapshot->rids.size() > ring->maxObjects())
+        {
+            SWSS_LOG_WARN("counter group %s have %zu objects, only %u will be written to ring",
+                    group.name.c_str(),
+                    snapshot->rids.size(),
+                    ring->maxObjects());
+        }
+    }
+
+    void beginCycle()
+    {
+        now = std::chrono::steady_clock::now();
+
+        if (adaptive && group.objectType == SAI_OBJECT_TYPE_PORT)
+            updateOperStatus();
+    }
+
+    void updateOperStatus()
+    {
+        uint64_t current = g_portOperStatusGeneration;
+
+        if (current == operStatusGeneration)
+            return;
+
+        operStatusGeneration = current;
+
+        std::unordered_map<sai_object_id_t, sai_port_oper_status_t> status;
+
+        {
+            std::lock_guard<std::mutex> lock(g_portOperStatusMutex);
+
+            status = g_portOperStatus;
+        }
+
+        for (size_t i = 0; i < snapshot->rids.size(); i++)
+        {
+            auto it = status.find(snapshot->rids[i]);
+
+            if (it == status.end())
+                continue;
+
+            auto old = operStatus.find(snapshot->rids[i]);
+
+            if (old != operStatus.end() && old->second == it->second)
+                continue;
+
+            // port which changed state is polled in this cycle
+
+            schedules[i].intervalMs = group.intervalMs;
+            schedules[i].nextRun = now;
+        }
+
+        operStatus.swap(status);
+    }
+
+    bool isDue(
+            _In_ size_t objectIndex) const
+    {
+        if (!adaptive)
+            return true;
+
+        // cycles don't start exactly on time, so allow half of min interval
 
-    SWSS_LOG_TIMER("get counters");
+        return schedules[objectIndex].nextRun <= now + std::chrono::milliseconds(group.intervalMs / 2);
+    }
 
-    uint32_t countersSize = supportedCounters.size();
+    /*
+     * Returns true when raw counters of object differ from previous cycle,
+     * rates are not compared since they decay slowly after traffic stops.
+     */
+    bool countersChanged(
+            _In_ size_t objectIndex,
+            _In_ const std::vector<uint64_t> &counters) const
+    {
+        const std::vector<uint64_t> &prev = previous[objectIndex];
 
-    std::vector<uint64_t> counters;
+        size_t count = objectCounters[objectIndex].ids.size();
 
-    counters.resize(countersSize);
+        if (prev.size() < count || counters.size() < count)
+            return true;
 
-    auto ports = saiGetPortList();
+        return !std::equal(counters.begin(), counters.begin() + count, prev.begin());
+    }
 
-    for (auto &portId: ports)
+    void reschedule(
+            _In_ size_t objectIndex,
+            _In_ bool changed)
     {
-        sai_status_t status = sai_port_api->get_port_stats(portId, supportedCounters.data(), countersSize, counters.data());
+        if (!adaptive)
+            return;
 
-        if (status != SAI_STATUS_SUCCESS)
+        ObjectSchedule &schedule = schedules[objectIndex];
+
+        auto it = operStatus.find(snapshot->rids[objectIndex]);
+
+        if (it != operStatus.end() && it->second == SAI_PORT_OPER_STATUS_DOWN)
         {
-            SWSS_LOG_ERROR("failed to collect counters for port %llx: %d", portId, status);
-            return;
+            schedule.intervalMs = group.maxIntervalMs;
+        }
+        else if (changed)
+        {
+            schedule.intervalMs = group.intervalMs;
+        }
+        else
+        {
+            schedule.intervalMs = std::min(schedule.intervalMs * 2, group.maxIntervalMs);
+        }
+
+        schedule.nextRun = now + std::chrono::milliseconds(schedule.intervalMs);
+    }
+
+    /*
+     * Appends rates of object to counters, so they are published in the
+     * same command as raw counters.
+     */
+    void appendRates(
+            _In_ size_t objectIndex,
+            _Inout_ std::vector<uint64_t> &counters)
+    {
+        for (auto &rate: objectRates[objectIndex])
+        {
+            uint64_t sum = 0;
+
+            for (auto position: rate.positions)
+            {
+                sum += counters[position];
+            }
+
+            // time is tracked per object, since collection of object could
+            // fail in some cycles, and counters could be cleared, then
+            // sample is skipped
+
+            double elapsed = std::chrono::duration<double>(now - rate.lastTime).count();
+
+            if (rate.hasLast && sum >= rate.lastSum && elapsed > 0)
+            {
+                double sample = (double)(sum - rate.lastSum) * rate.multiplier / elapsed;
+
+                if (rate.initialized)
+                {
+                    // weight depends on elapsed time, since objects are
+                    // polled on different and changing intervals
+
+                    double alpha = (group.rateTau > 0) ? 1 - exp(-elapsed / group.rateTau) : 1;
+
+                    rate.value = alpha * sample + (1 - alpha) * rate.value;
+                }
+                else
+                {
+                    rate.value = sample;
+                    rate.initialized = true;
+                }
+            }
+
+            rate.lastSum = sum;
+            rate.lastTime = now;
+            rate.hasLast = true;
+
+            counters.push_back((uint64_t)(rate.value + 0.5));
+        }
+    }
+
+    /*
+     * Writes object record to current ring sample, NULL counters marks
+     * object as not collected, so record from older sample is not left
+     * in slot.
+     */
+    void writeRecord(
+            _In_ size_t objectIndex,
+            _In_ const uint64_t *counters)
+    {
+        ring->writeRecord(objectIndex, snapshot->rawVids[objectIndex], objectCounters[objectIndex], counters);
+    }
+
+    /*
+     * Can be called from multiple workers, but each object index must be
+     * handled by single worker.
+     */
+    void queue(
+            _In_ CountersWorker &worker,
+            _In_ size_t objectIndex,
+            _In_ const std::vector<uint64_t> &counters)
+    {
+        std::string &command = worker.command;
+
+        const std::vector<size_t> &indexes = objectFields[objectIndex];
+
+        std::vector<uint64_t> &prev = previous[objectIndex];
+
+        ObjectSchedule &schedule = schedules[objectIndex];
+
+        auto refreshInterval = std::chrono::milliseconds((uint64_t)group.intervalMs * COUNTERS_FULL_REFRESH_CYCLES);
+
+        bool full = prev.size() != counters.size() || now - schedule.lastFullWrite >= refreshInterval;
+
+        size_t changed = 0;
+
+        for (size_t idx = 0; idx < counters.size(); idx++)
+        {
+            if (full || counters[idx] != prev[idx])
+                changed++;
         }
 
-        sai_object_id_t vid = translate_rid_to_vid(portId);
+        if (changed == 0)
+            return;
+
+        char buffer[20];
 
-        std::string strPortId;
-        sai_serialize_primitive(vid, strPortId);
+        const char *argc = formatUint64(2 + 2 * changed, buffer);
 
-        std::vector<swss::FieldValueTuple> values;
+        command.clear();
+
+        command += '*';
+        command.append(argc, buffer + 20 - argc);
+        command += "\r\n";
+        command += headers[objectIndex];
 
         for (size_t idx = 0; idx < counters.size(); idx++)
         {
-            std::string field = sai_get_port_stat_counter_name(supportedCounters[idx]);
-            std::string value = std::to_string(counters[idx]);
+            if (!full && counters[idx] == prev[idx])
+                continue;
+
+            const char *value = formatUint64(counters[idx], buffer);
 
-            swss::FieldValueTuple fvt(field, value);
+            command += fields[indexes[idx]];
 
-            values.push_back(fvt);
+            appendBulkString(command, value, buffer + 20 - value);
         }
 
-        countersTable.set(strPortId, values, "");
+        prev = counters;
+
+        if (full)
+            schedule.lastFullWrite = now;
+
+        worker.pipeline.pushFormatted(command, REDIS_REPLY_STATUS);
     }
-}
 
-std::vector<sai_port_stat_counter_t> getSupportedCounters(sai_object_id_t portId)
+    const CounterGroup &group;
+
+    swss::Table &table;
+
+    // indexed by group stat index
+    std::vector<std::string> fields;
+
+    std::unordered_map<sai_object_id_t, SupportedCounters> supportedCache;
+
+    std::shared_ptr<const CounterObjectsSnapshot> snapshot;
+
+    uint64_t generation;
+
+    // indexed by object index in snapshot
+    std::vector<std::string> headers;
+    std::vector<SupportedCounters> objectCounters;
+    std::vector<std::vector<size_t>> objectFields;
+    std::vector<std::vector<RateState>> objectRates;
+    std::vector<std::vector<uint64_t>> previous;
+
+    std::chrono::steady_clock::time_point now;
+
+    std::shared_ptr<CountersRingWriter> ring;
+
+    bool adaptive;
+
+    // indexed by object index in snapshot
+    std::vector<ObjectSchedule> schedules;
+
+    // oper status of ports known to this writer
+    std::unordered_map<sai_object_id_t, sai_port_oper_status_t> operStatus;
+
+    uint64_t operStatusGeneration;
+};
+
+void collectCountersShard(
+        _In_ CounterGroupWriter &writer,
+        _In_ CountersWorker &worker,
+        _In_ size_t shard,
+        _In_ size_t shards)
 {
     SWSS_LOG_ENTER();
 
-    std::vector<sai_port_stat_counter_t> supportedCounters;
+    const auto &snapshot = *writer.snapshot;
+
+    std::vector<uint64_t> &counters = worker.counters;
+
+    worker.polled = 0;
+    worker.slowestMs = 0;
+    worker.slowestObject = SAI_NULL_OBJECT_ID;
 
-    for (int idx = SAI_PORT_STAT_IF_IN_OCTETS;
-         idx <= SAI_PORT_STAT_ETHER_OUT_PKTS_9217_TO_16383_OCTETS;
-         ++idx)
+    for (size_t i = shard; i < snapshot.rids.size(); i += shards)
     {
-        sai_port_stat_counter_t counter = (sai_port_stat_counter_t)idx;
+        if (!writer.isDue(i))
+            continue;
 
-        uint64_t value;
+        sai_object_id_t objectId = snapshot.rids[i];
+
+        const SupportedCounters &supported = writer.objectCounters[i];
+
+        if (supported.ids.empty())
+        {
+            if (writer.ring)
+                writer.writeRecord(i, NULL);
+
+            continue;
+        }
+
+        counters.resize(supported.ids.size());
+
+        worker.polled++;
+
+        auto start = std::chrono::steady_clock::now();
+
+        sai_status_t status = writer.group.getStats(objectId, supported.ids.data(), (uint32_t)supported.ids.size(), counters.data());
 
-        sai_status_t status = sai_port_api->get_port_stats(portId, &counter, 1, &value);
+        double ms = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+
+        if (ms > worker.slowestMs)
+        {
+            worker.slowestMs = ms;
+            worker.slowestObject = objectId;
+        }
 
         if (status != SAI_STATUS_SUCCESS)
         {
-            const std::string &name = sai_get_port_stat_counter_name(counter);
+            // don't drop counters of remaining objects
+            SWSS_LOG_ERROR("failed to collect %s counters for %llx: %d", writer.group.name.c_str(), objectId, status);
+
+            if (writer.ring)
+                writer.writeRecord(i, NULL);
+
+            writer.reschedule(i, false);
+
+            continue;
+        }
 
-            SWSS_LOG_WARN("counter %s is not supported on port RID %llx: %d", name.c_str(), portId, status);
+        if (writer.ring)
+        {
+            writer.writeRecord(i, counters.data());
             continue;
         }
 
-        supportedCounters.push_back(counter);
+        bool changed = writer.countersChanged(i, counters);
+
+        writer.appendRates(i, counters);
+
+        writer.queue(worker, i, counters);
+
+        writer.reschedule(i, changed);
+    }
+
+    // all objects of shard are written in single round trip
+
+    worker.pipeline.flush();
+}
+
+void collectCounters(
+        _In_ CounterGroupWriter &writer,
+        _In_ std::vector<std::shared_ptr<CountersWorker>> &workers)
+{
+    // counters are collected without g_mutex, on objects snapshot, so
+    // configuration is not blocked during collection, vendor SAI
+    // must allow get stats concurrently with other apis
+
+    SWSS_LOG_ENTER();
+
+    auto start = std::chrono::steady_clock::now();
+
+    writer.updateObjects(workers);
+
+    writer.beginCycle();
+
+    if (writer.ring)
+        writer.ring->beginSample((uint32_t)writer.snapshot->rids.size());
+
+    size_t shards = std::min(workers.size(), writer.snapshot->rids.size());
+
+    if (shards <= 1)
+    {
+        collectCountersShard(writer, *workers.at(0), 0, 1);
+
+        shards = 1;
+    }
+    else
+    {
+        runOnCountersWorkers(workers, shards, [&](size_t shard) {
+                collectCountersShard(writer, *workers[shard], shard, shards);
+                });
+    }
+
+    // sample is published when all shards are done
+
+    if (writer.ring)
+        writer.ring->endSample();
+
+    size_t polled = 0;
+    double slowestMs = 0;
+    sai_object_id_t slowestObject = SAI_NULL_OBJECT_ID;
+
+    for (size_t shard = 0; shard < shards; shard++)
+    {
+        polled += workers[shard]->polled;
+
+        if (workers[shard]->slowestMs >= slowestMs)
+        {
+            slowestMs = workers[shard]->slowestMs;
+            slowestObject = workers[shard]->slowestObject;
+        }
+    }
+
+    double totalMs = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+
+    SWSS_LOG_INFO("%s counters: %zu objects, %zu polled, %zu workers, total %.3f ms, slowest RID %llx %.3f ms",
+            writer.group.name.c_str(),
+            writer.snapshot->rids.size(),
+            polled,
+            shards,
+            totalMs,
+            slowestObject,
+            slowestMs);
+}
+
+sai_status_t getPortStats(
+        _In_ sai_object_id_t objectId,
+        _In_ const int32_t *counterIds,
+        _In_ uint32_t count,
+        _Out_ uint64_t *counters)
+{
+    return sai_port_api->get_port_stats(objectId, (const sai_port_stat_counter_t*)counterIds, count, counters);
+}
+
+sai_status_t getQueueStats(
+        _In_ sai_object_id_t objectId,
+        _In_ const int32_t *counterIds,
+        _In_ uint32_t count,
+        _Out_ uint64_t *counters)
+{
+    return sai_queue_api->get_queue_stats(objectId, (const sai_queue_stat_counter_t*)counterIds, count, counters);
+}
+
+sai_status_t getPriorityGroupStats(
+        _In_ sai_object_id_t objectId,
+        _In_ const int32_t *counterIds,
+        _In_ uint32_t count,
+        _Out_ uint64_t *counters)
+{
+    return sai_buffer_api->get_ingress_priority_group_stats(objectId, (const sai_ingress_priority_group_stat_counter_t*)counterIds, count, counters);
+}
+
+sai_status_t getBufferPoolStats(
+        _In_ sai_object_id_t objectId,
+        _In_ const int32_t *counterIds,
+        _In_ uint32_t count,
+        _Out_ uint64_t *counters)
+{
+    return sai_buffer_api->get_buffer_pool_stats(objectId, (const sai_buffer_pool_stat_counter_t*)counterIds, count, counters);
+}
+
+sai_status_t getPolicerStats(
+        _In_ sai_object_id_t objectId,
+        _In_ const int32_t *counterIds,
+        _In_ uint32_t count,
+        _Out_ uint64_t *counters)
+{
+    return sai_policer_api->get_policer_statistics(objectId, (const sai_policer_stat_counter_t*)counterIds, count, counters);
+}
+
+/*
+ * ACL counter don't have stats api, packets and bytes are attributes,
+ * so counter ids are attribute ids.
+ */
+sai_status_t getAclCounterStats(
+        _In_ sai_object_id_t objectId,
+        _In_ const int32_t *counterIds,
+        _In_ uint32_t count,
+        _Out_ uint64_t *counters)
+{
+    sai_attribute_t attrs[2];
+
+    if (count > 2)
+        return SAI_STATUS_INVALID_PARAMETER;
+
+    for (uint32_t i = 0; i < count; i++)
+    {
+        attrs[i].id = counterIds[i];
+    }
+
+    sai_status_t status = sai_acl_api->get_acl_counter_attribute(objectId, count, attrs);
+
+    if (status != SAI_STATUS_SUCCESS)
+        return status;
+
+    for (uint32_t i = 0; i < count; i++)
+    {
+        counters[i] = attrs[i].value.u64;
+    }
+
+    return SAI_STATUS_SUCCESS;
+}
+
+#define STAT(x) { x, #x }
+
+/*
+ * Interval of group can be changed in profile using key
+ * SYNCD_COUNTERS_INTERVAL_<group name> with value in milliseconds,
+ * 0 disables group.
+ */
+uint32_t getCounterGroupInterval(
+        _In_ const std::string &name,
+        _In_ uint32_t defaultIntervalMs)
+{
+    SWSS_LOG_ENTER();
+
+    std::string key = "SYNCD_COUNTERS_INTERVAL_" + name;
+
+    const char *value = profile_get_value(0, key.c_str());
+
+    if (value == NULL)
+        return defaultIntervalMs;
+
+    return (uint32_t)strtoul(value, NULL, 10);
+}
+
+/*
+ * Max interval of adaptive group can be set in profile using key
+ * SYNCD_COUNTERS_MAX_INTERVAL_<group name> with value in milliseconds,
+ * 0 disables adaptive polling of group.
+ */
+uint32_t getCounterGroupMaxInterval(
+        _In_ const std::string &name,
+        _In_ uint32_t defaultMaxIntervalMs)
+{
+    SWSS_LOG_ENTER();
+
+    std::string key = "SYNCD_COUNTERS_MAX_INTERVAL_" + name;
+
+    const char *value = profile_get_value(0, key.c_str());
+
+    if (value == NULL)
+        return defaultMaxIntervalMs;
+
+    return (uint32_t)strtoul(value, NULL, 10);
+}
+
+#define DEFAULT_RATE_TAU 5.0
+
+/*
+ * EWMA time constant of rates in seconds can be changed in profile using
+ * key SYNCD_COUNTERS_RATE_TAU, value 0 disables smoothing. Weight of new
+ * sample is 1 - exp(-elapsed / tau), so rate decays at the same speed
+ * regardless of polling interval of object.
+ */
+double getCounterRateTau()
+{
+    SWSS_LOG_ENTER();
+
+    const char *value = profile_get_value(0, "SYNCD_COUNTERS_RATE_TAU");
+
+    if (value == NULL)
+        return DEFAULT_RATE_TAU;
+
+    char *end = NULL;
+
+    double tau = strtod(value, &end);
+
+    if (end == value || tau < 0)
+    {
+        SWSS_LOG_WARN("invalid rate tau %s, using %f", value, DEFAULT_RATE_TAU);
+
+        return DEFAULT_RATE_TAU;
+    }
+
+    return tau;
+}
+
+#define DEFAULT_RING_INTERVAL_MS    100
+#define DEFAULT_RING_SLOTS          64
+#define DEFAULT_RING_MAX_PORTS      256
+
+uint32_t getProfileUint(
+        _In_ const char *key,
+        _In_ uint32_t defaultValue)
+{
+    SWSS_LOG_ENTER();
+
+    const char *value = profile_get_value(0, key);
+
+    if (value == NULL)
+        return defaultValue;
+
+    uint32_t result = (uint32_t)strtoul(value, NULL, 10);
+
+    if (result == 0)
+    {
+        SWSS_LOG_WARN("invalid %s value %s, using %u", key, value, defaultValue);
+
+        return defaultValue;
     }
 
-    return std::move(supportedCounters);
+    return result;
+}
+
+/*
+ * Port counters can be also written to shared memory ring, for local
+ * readers which need samples more often than it's reasonable to write
+ * them to redis. Ring is enabled by setting SYNCD_COUNTERS_RING_FILE in
+ * profile (like /dev/shm/port_counters), number of samples kept and max
+ * ports can be set by SYNCD_COUNTERS_RING_SLOTS and
+ * SYNCD_COUNTERS_RING_MAX_PORTS.
+ */
+void registerPortRingCounterGroup(
+        _In_ const CounterGroup &port)
+{
+    SWSS_LOG_ENTER();
+
+    const char *ringFile = profile_get_value(0, "SYNCD_COUNTERS_RING_FILE");
+
+    if (ringFile == NULL || *ringFile == 0)
+        return;
+
+    CounterGroup ring = port;
+
+    ring.name = "PORT_RING";
+    ring.rates.clear();
+    ring.intervalMs = getCounterGroupInterval(ring.name, DEFAULT_RING_INTERVAL_MS);
+    ring.maxIntervalMs = 0; // ring samples contain all ports
+    ring.ringFile = ringFile;
+    ring.ringSlots = getProfileUint("SYNCD_COUNTERS_RING_SLOTS", DEFAULT_RING_SLOTS);
+    ring.ringMaxObjects = getProfileUint("SYNCD_COUNTERS_RING_MAX_PORTS", DEFAULT_RING_MAX_PORTS);
+
+    registerCounterGroup(ring);
+}
+
+// idle ports are polled at most 8 times slower than busy ports
+#define DEFAULT_PORT_MAX_INTERVAL_FACTOR 8
+
+void registerDefaultCounterGroups(
+        _In_ int intervalInSeconds)
+{
+    SWSS_LOG_ENTER();
+
+    uint32_t defaultIntervalMs = intervalInSeconds * 1000;
+
+    double rateTau = getCounterRateTau();
+
+    CounterGroup port;
+
+    port.name = "PORT";
+    port.objectType = SAI_OBJECT_TYPE_PORT;
+    port.getStats = sai_port_api ? getPortStats : NULL;
+    port.intervalMs = getCounterGroupInterval(port.name, defaultIntervalMs);
+    port.maxIntervalMs = getCounterGroupMaxInterval(port.name, port.intervalMs * DEFAULT_PORT_MAX_INTERVAL_FACTOR);
+    port.rateTau = rateTau;
+
+    for (int idx = SAI_PORT_STAT_IF_IN_OCTETS; idx <= SAI_PORT_STAT_ETHER_OUT_PKTS_9217_TO_16383_OCTETS; ++idx)
+    {
+        port.stats.push_back({ idx, sai_get_port_stat_counter_name((sai_port_stat_counter_t)idx) });
+    }
+
+    port.rates = {
+        { "RX_BPS", { SAI_PORT_STAT_IF_IN_OCTETS }, 8 },
+        { "TX_BPS", { SAI_PORT_STAT_IF_OUT_OCTETS }, 8 },
+        { "RX_PPS", { SAI_PORT_STAT_IF_IN_UCAST_PKTS, SAI_PORT_STAT_IF_IN_NON_UCAST_PKTS }, 1 },
+        { "TX_PPS", { SAI_PORT_STAT_IF_OUT_UCAST_PKTS, SAI_PORT_STAT_IF_OUT_NON_UCAST_PKTS }, 1 },
+    };
+
+    registerCounterGroup(port);
+
+    registerPortRingCounterGroup(port);
+
+    CounterGroup queue;
+
+    queue.name = "QUEUE";
+    queue.objectType = SAI_OBJECT_TYPE_QUEUE;
+    queue.getStats = sai_queue_api ? getQueueStats : NULL;
+    queue.intervalMs = getCounterGroupInterval(queue.name, defaultIntervalMs);
+    queue.maxIntervalMs = getCounterGroupMaxInterval(queue.name, 0);
+    queue.rateTau = rateTau;
+    queue.stats = {
+        STAT(SAI_QUEUE_STAT_PACKETS),
+        STAT(SAI_QUEUE_STAT_BYTES),
+        STAT(SAI_QUEUE_STAT_DROPPED_PACKETS),
+        STAT(SAI_QUEUE_STAT_DROPPED_BYTES),
+        STAT(SAI_QUEUE_STAT_CURR_OCCUPANCY_BYTES),
+        STAT(SAI_QUEUE_STAT_WATERMARK_BYTES),
+        STAT(SAI_QUEUE_STAT_SHARED_CURR_OCCUPANCY_BYTES),
+        STAT(SAI_QUEUE_STAT_SHARED_WATERMARK_BYTES),
+    };
+
+    registerCounterGroup(queue);
+
+    CounterGroup pg;
+
+    pg.name = "PG";
+    pg.objectType = SAI_OBJECT_TYPE_PRIORITY_GROUP;
+    pg.getStats = sai_buffer_api ? getPriorityGroupStats : NULL;
+    pg.intervalMs = getCounterGroupInterval(pg.name, defaultIntervalMs);
+    pg.maxIntervalMs = getCounterGroupMaxInterval(pg.name, 0);
+    pg.rateTau = rateTau;
+    pg.stats = {
+        STAT(SAI_INGRESS_PRIORITY_GROUP_STAT_PACKETS),
+        STAT(SAI_INGRESS_PRIORITY_GROUP_STAT_BYTES),
+        STAT(SAI_INGRESS_PRIORITY_GROUP_STAT_CURR_OCCUPANCY_BYTES),
+        STAT(SAI_INGRESS_PRIORITY_GROUP_STAT_WATERMARK_BYTES),
+        STAT(SAI_INGRESS_PRIORITY_GROUP_STAT_SHARED_CURR_OCCUPANCY_BYTES),
+        STAT(SAI_INGRESS_PRIORITY_GROUP_STAT_SHARED_WATERMARK_BYTES),
+        STAT(SAI_INGRESS_PRIORITY_GROUP_STAT_XOFF_ROOM_CURR_OCCUPANCY_BYTES),
+        STAT(SAI_INGRESS_PRIORITY_GROUP_STAT_XOFF_ROOM_WATERMARK_BYTES),
+    };
+
+    registerCounterGroup(pg);
+
+    CounterGroup bufferPool;
+
+    bufferPool.name = "BUFFER_POOL";
+    bufferPool.objectType = SAI_OBJECT_TYPE_BUFFER_POOL;
+    bufferPool.getStats = sai_buffer_api ? getBufferPoolStats : NULL;
+    bufferPool.intervalMs = getCounterGroupInterval(bufferPool.name, defaultIntervalMs);
+    bufferPool.maxIntervalMs = getCounterGroupMaxInterval(bufferPool.name, 0);
+    bufferPool.rateTau = rateTau;
+    bufferPool.stats = {
+        STAT(SAI_BUFFER_POOL_STAT_CURR_OCCUPANCY_BYTES),
+        STAT(SAI_BUFFER_POOL_STAT_WATERMARK_BYTES),
+    };
+
+    registerCounterGroup(bufferPool);
+
+    CounterGroup aclCounter;
+
+    aclCounter.name = "ACL_COUNTER";
+    aclCounter.objectType = SAI_OBJECT_TYPE_ACL_COUNTER;
+    aclCounter.getStats = sai_acl_api ? getAclCounterStats : NULL;
+    aclCounter.intervalMs = getCounterGroupInterval(aclCounter.name, defaultIntervalMs);
+    aclCounter.maxIntervalMs = getCounterGroupMaxInterval(aclCounter.name, 0);
+    aclCounter.rateTau = rateTau;
+    aclCounter.stats = {
+        STAT(SAI_ACL_COUNTER_ATTR_PACKETS),
+        STAT(SAI_ACL_COUNTER_ATTR_BYTES),
+    };
+
+    registerCounterGroup(aclCounter);
+
+    CounterGroup policer;
+
+    policer.name = "POLICER";
+    policer.objectType = SAI_OBJECT_TYPE_POLICER;
+    policer.getStats = sai_policer_api ? getPolicerStats : NULL;
+    policer.intervalMs = getCounterGroupInterval(policer.name, defaultIntervalMs);
+    policer.maxIntervalMs = getCounterGroupMaxInterval(policer.name, 0);
+    policer.rateTau = rateTau;
+    policer.stats = {
+        STAT(SAI_POLICER_STAT_PACKETS),
+        STAT(SAI_POLICER_STAT_GREEN_PACKETS),
+        STAT(SAI_POLICER_STAT_GREEN_BYTES),
+        STAT(SAI_POLICER_STAT_YELLOW_PACKETS),
+        STAT(SAI_POLICER_STAT_YELLOW_BYTES),
+        STAT(SAI_POLICER_STAT_RED_PACKETS),
+        STAT(SAI_POLICER_STAT_RED_BYTES),
+    };
+
+    registerCounterGroup(policer);
 }
 
 static volatile bool  g_runCountersThread = false;
@@ -93,22 +1771,74 @@ void collectCountersThread(int intervalInSeconds)
     SWSS_LOG_ENTER();
 
     swss::DBConnector db(COUNTERS_DB, "localhost", 6379, 0);
-    swss::Table countersTable(&db, "COUNTERS");
+    swss::Table table(&db, "COUNTERS");
+
+    registerDefaultCounterGroups(intervalInSeconds);
+
+    std::vector<std::shared_ptr<CountersWorker>> workers;
+
+    size_t workersCount = getCountersWorkersCount();
+
+    for (size_t i = 0; i < workersCount; i++)
+    {
+        workers.push_back(std::make_shared<CountersWorker>());
+    }
+
+    // single worker is run on counters thread, it don't need own thread
+
+    if (workersCount > 1)
+    {
+        for (auto &worker: workers)
+        {
+            worker->start();
+        }
+    }
+
+    // supported counters are probed on first collection of each group
 
-    auto ports = saiGetPortList();
+    std::vector<std::shared_ptr<CounterGroupWriter>> writers;
+    std::vector<std::chrono::steady_clock::time_point> nextRun;
 
-    // get supported counters on first port
-    // we assume that all ports will support those counters
-    const auto &supportedCounters = getSupportedCounters(ports.at(0));
+    for (const auto &group: g_counterGroups)
+    {
+        writers.push_back(std::make_shared<CounterGroupWriter>(group, table));
+        nextRun.push_back(std::chrono::steady_clock::now());
+    }
 
-    SWSS_LOG_INFO("supported counters count: %ld", supportedCounters.size());
+    if (writers.empty())
+    {
+        SWSS_LOG_NOTICE("no counter groups enabled");
+        return;
+    }
 
     while(g_runCountersThread)
     {
-        collectCounters(countersTable, supportedCounters);
+        auto now = std::chrono::steady_clock::now();
+
+        auto wakeup = now + std::chrono::seconds(intervalInSeconds);
+
+        for (size_t i = 0; i < writers.size(); i++)
+        {
+            auto interval = std::chrono::milliseconds(writers[i]->group.intervalMs);
+
+            if (now >= nextRun[i])
+            {
+                collectCounters(*writers[i], workers);
+
+                nextRun[i] += interval;
+
+                if (nextRun[i] < now)
+                {
+                    // collection took longer than interval, skip missed runs
+                    nextRun[i] = now + interval;
+                }
+            }
+
+            wakeup = std::min(wakeup, nextRun[i]);
+        }
 
         std::unique_lock<std::mutex> lk(mtx_sleep);
-        cv_sleep.wait_for(lk, std::chrono::seconds(intervalInSeconds));
+        cv_sleep.wait_until(lk, wakeup);
     }
 }
 
@@ -1,6 +1,9 @@
 #include <string>
 #include <vector>
 #include <unordered_map>
+#include <unordered_set>
+#include <atomic>
+#include <chrono>
 
 #include "syncd.h"
 
@@ -32,6 +35,23 @@ void processRoutes();
 void processTraps();
 
 sai_object_type_t getObjectTypeFromAsicKey(const std::string &key);
+sai_object_id_t getObjectIdFromString(const std::string &strObjectId);
+
+/*
+ * Context of single OID object recreation. Recreation is split into prepare
+ * (translate attributes), execute (SAI create or set) and record (update
+ * translated map) so execute step of independent objects can be issued
+ * concurrently.
+ */
+struct VidRecreateContext
+{
+    sai_object_id_t vid;
+    sai_object_id_t rid;
+    sai_object_type_t objectType;
+    bool createObject;
+    std::shared_ptr<SaiAttributeList> list;
+    sai_status_t status;
+};
 
 sai_object_type_t getObjectTypeFromVid(sai_object_id_t sai_object_id)
 {
@@ -50,7 +70,9 @@ sai_object_type_t getObjectTypeFromVid(sai_object_id_t sai_object_id)
     return objectType;
 }
 
-std::shared_ptr<SaiAttributeList> redisGetAttributesFromAsicKey(const std::string &key)
+std::shared_ptr<SaiAttributeList> redisGetAttributesFromAsicHash(
+        _In_ const std::string &key,
+        _In_ const StringHash &hash)
 {
     SWSS_LOG_ENTER();
 
@@ -58,8 +80,6 @@ std::shared_ptr<SaiAttributeList> redisGetAttributesFromAsicKey(const std::strin
 
     std::vector<swss::FieldValueTuple> values;
 
-    auto hash = g_redisClient->hgetall(key);
-
     for (auto &kv: hash)
     {
         const std::string &key = kv.first;
@@ -106,8 +126,8 @@ void redisSetVidAndRidMap(std::unordered_map<sai_object_id_t, sai_object_id_t> m
 {
     SWSS_LOG_ENTER();
 
-    redisClearVidToRidMap();
-    redisClearRidToVidMap();
+    std::unordered_map<std::string, std::string> vidToRid;
+    std::unordered_map<std::string, std::string> ridToVid;
 
     for (auto &kv: map)
     {
@@ -117,9 +137,24 @@ void redisSetVidAndRidMap(std::unordered_map<sai_object_id_t, sai_object_id_t> m
         sai_serialize_primitive(kv.first, strVid);
         sai_serialize_primitive(kv.second, strRid);
 
-        g_redisClient->hset(VIDTORID, strVid, strRid);
-        g_redisClient->hset(RIDTOVID, strRid, strVid);
+        vidToRid[strVid] = strRid;
+        ridToVid[strRid] = strVid;
+    }
+
+    // clear and set both maps in single round trip
+
+    swss::RedisPipeline pipeline(g_redisClient);
+
+    pipeline.del(VIDTORID);
+    pipeline.del(RIDTOVID);
+
+    if (map.size())
+    {
+        pipeline.hmset(VIDTORID, vidToRid);
+        pipeline.hmset(RIDTOVID, ridToVid);
     }
+
+    pipeline.flush();
 }
 
 void checkAllIds()
@@ -155,6 +190,23 @@ void checkAllIds()
     }
 
     redisSetVidAndRidMap(g_translated);
+
+    vidRidCacheReset(g_translated);
+}
+
+void processTimed(
+        _In_ const char *name,
+        _In_ void (*fn)())
+{
+    SWSS_LOG_ENTER();
+
+    auto start = std::chrono::steady_clock::now();
+
+    fn();
+
+    auto time = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - start);
+
+    SWSS_LOG_NOTICE("hard reinit %s took %ld ms", name, (long)time.count());
 }
 
 void hardReinit()
@@ -166,10 +218,17 @@ void hardReinit()
     g_vidToRidMap = redisGetVidToRidMap();
     g_ridToVidMap = redisGetRidToVidMap();
 
-    std::vector<std::string> asicStateKeys = redisGetAsicStateKeys();
+    // ASIC state is streamed in batches instead of KEYS and HGETALL per key,
+    // attributes of each key are parsed as soon as batch arrives
+
+    g_redisClient->scanHashes(ASIC_STATE_PATTERN, ASIC_STATE_SCAN_COUNT, [&](const std::string &key, const StringHash &hash) {
+
+        if (g_attributesLists.find(key) != g_attributesLists.end())
+        {
+            // SCAN can return same key more than once
+            return;
+        }
 
-    for (auto &key: asicStateKeys)
-    {
         sai_object_type_t objectType = getObjectTypeFromAsicKey(key);
         const std::string &strObjectId = getObjectIdFromAsicKey(key);
 
@@ -204,51 +263,42 @@ void hardReinit()
                 break;
         }
 
-        g_attributesLists[key] = redisGetAttributesFromAsicKey(key);
-    }
+        g_attributesLists[key] = redisGetAttributesFromAsicHash(key, hash);
+    });
+
+    SWSS_LOG_NOTICE("loaded %zu ASIC state entries", g_attributesLists.size());
+
+    // order of those steps matters, objects needed by fdbs and neighbors
+    // are created on demand, remaining OIDs are created level by level
 
-    processSwitch();
-    processVlans();
-    processFdbs();
-    processNeighbors();
-    processOids();
-    processRoutes();
-    processTraps();
+    processTimed("switch", processSwitch);
+    processTimed("vlans", processVlans);
+    processTimed("fdbs", processFdbs);
+    processTimed("neighbors", processNeighbors);
+    processTimed("oids", processOids);
+    processTimed("routes", processRoutes);
+    processTimed("traps", processTraps);
 
     checkAllIds();
 }
 
-sai_object_id_t processSingleVid(sai_object_id_t vid)
+VidRecreateContext prepareSingleVid(sai_object_id_t vid)
 {
     SWSS_LOG_ENTER();
 
-    if (vid == SAI_NULL_OBJECT_ID)
-    {
-        SWSS_LOG_DEBUG("processed VID 0 to RID 0");
-
-        return SAI_NULL_OBJECT_ID;
-    }
-
-    auto it = g_translated.find(vid);
-
-    if (it != g_translated.end())
-    {
-        // this object was already processed,
-        // just return real object id
-
-        SWSS_LOG_DEBUG("processed VID %llx to RID %llx", vid, it->second);
+    VidRecreateContext ctx;
 
-        return it->second;
-    }
+    ctx.vid = vid;
+    ctx.rid = SAI_NULL_OBJECT_ID;
+    ctx.objectType = getObjectTypeFromVid(vid);
+    ctx.createObject = true;
+    ctx.status = SAI_STATUS_SUCCESS;
 
-    sai_object_id_t rid;
-    sai_object_type_t objectType = getObjectTypeFromVid(vid);
+    sai_object_type_t objectType = ctx.objectType;
 
     std::string strVid;
     sai_serialize_primitive(vid, strVid);
 
-    bool createObject = true;
-
     if (objectType == SAI_OBJECT_TYPE_VIRTUAL_ROUTER)
     {
         auto it = g_vidToRidMap.find(vid);
@@ -269,11 +319,11 @@ sai_object_id_t processSingleVid(sai_object_id_t vid)
             // this is default virtual router id
             // we don't need to create it, just set attributes
 
-            rid = defaultVirtualRouterId;
+            ctx.rid = defaultVirtualRouterId;
 
-            createObject = false;
+            ctx.createObject = false;
             
-            SWSS_LOG_INFO("default virtual router will not be created, processed VID %llx to RID %llx", vid, rid);
+            SWSS_LOG_INFO("default virtual router will not be created, processed VID %llx to RID %llx", vid, ctx.rid);
         }
 
     }
@@ -291,11 +341,11 @@ sai_object_id_t processSingleVid(sai_object_id_t vid)
             exit(EXIT_FAILURE);
         }
 
-        rid = it->second;
+        ctx.rid = it->second;
 
-        createObject = false;
+        ctx.createObject = false;
 
-        SWSS_LOG_INFO("port will not be created, processed VID %llx to RID %llx", vid, rid);
+        SWSS_LOG_INFO("port will not be created, processed VID %llx to RID %llx", vid, ctx.rid);
     }
 
     auto oit = g_oids.find(strVid);
@@ -309,39 +359,50 @@ sai_object_id_t processSingleVid(sai_object_id_t vid)
 
     std::string asicKey = oit->second;;
 
-    std::shared_ptr<SaiAttributeList> list = g_attributesLists[asicKey];
+    ctx.list = g_attributesLists[asicKey];
 
-    processAttributesForOids(objectType, list); // recursion
+    processAttributesForOids(objectType, ctx.list); // recursion
 
-    sai_attribute_t *attrList = list->get_attr_list();
+    if (ctx.createObject && common_create[objectType] == NULL)
+    {
+        SWSS_LOG_ERROR("create function is not defined for object type %llx", objectType);
 
-    uint32_t attrCount = list->get_attr_count();
+        exit(EXIT_FAILURE);
+    }
 
-    if (createObject)
-    {
-        create_fn create = common_create[objectType];
+    return ctx;
+}
 
-        if (create == NULL)
-        {
-            SWSS_LOG_ERROR("create function is not defined for object type %llx", objectType);
+/*
+ * Only SAI api is called here, no global state is touched, so this function
+ * can be executed from multiple threads on different contexts.
+ */
+void executeSingleVid(VidRecreateContext &ctx)
+{
+    sai_object_type_t objectType = ctx.objectType;
 
-            exit(EXIT_FAILURE);
-        }
+    sai_attribute_t *attrList = ctx.list->get_attr_list();
 
-        sai_status_t status = create(&rid, attrCount, attrList);
+    uint32_t attrCount = ctx.list->get_attr_count();
 
-        if (status != SAI_STATUS_SUCCESS)
+    if (ctx.createObject)
+    {
+        create_fn create = common_create[objectType];
+
+        ctx.status = create(&ctx.rid, attrCount, attrList);
+
+        if (ctx.status != SAI_STATUS_SUCCESS)
         {
-            SWSS_LOG_ERROR("failed to create object %llx: %d", objectType, status);
+            SWSS_LOG_ERROR("failed to create object %llx: %d", objectType, ctx.status);
 
-            exit(EXIT_FAILURE);
+            return;
         }
 
-        SWSS_LOG_DEBUG("created object of type %x, processed VID %llx to RID %llx", objectType, vid, rid);
+        SWSS_LOG_DEBUG("created object of type %x, processed VID %llx to RID %llx", objectType, ctx.vid, ctx.rid);
     }
     else
     {
-        SWSS_LOG_DEBUG("setting attributes on object of type %x, processed VID %llx to RID %llx", objectType, vid, rid);
+        SWSS_LOG_DEBUG("setting attributes on object of type %x, processed VID %llx to RID %llx", objectType, ctx.vid, ctx.rid);
 
         set_attribute_fn set = common_set_attribute[objectType];
 
@@ -349,20 +410,62 @@ sai_object_id_t processSingleVid(sai_object_id_t vid)
         {
             sai_attribute_t *attr = &attrList[idx];
 
-            sai_status_t status = set(rid, attr);
+            ctx.status = set(ctx.rid, attr);
 
-            if (status != SAI_STATUS_SUCCESS)
+            if (ctx.status != SAI_STATUS_SUCCESS)
             {
-                SWSS_LOG_ERROR("failed to set attribute for object type %llx attr id %llx: %d", objectType, attr->id, status);
+                SWSS_LOG_ERROR("failed to set attribute for object type %llx attr id %llx: %d", objectType, attr->id, ctx.status);
 
-                exit(EXIT_FAILURE);
+                return;
             }
         }
     }
+}
+
+void recordSingleVid(const VidRecreateContext &ctx)
+{
+    SWSS_LOG_ENTER();
+
+    if (ctx.status != SAI_STATUS_SUCCESS)
+    {
+        SWSS_LOG_ERROR("failed to process VID %llx of type %x: %d", ctx.vid, ctx.objectType, ctx.status);
+
+        exit(EXIT_FAILURE);
+    }
+
+    g_translated[ctx.vid] = ctx.rid;
+}
+
+sai_object_id_t processSingleVid(sai_object_id_t vid)
+{
+    SWSS_LOG_ENTER();
+
+    if (vid == SAI_NULL_OBJECT_ID)
+    {
+        SWSS_LOG_DEBUG("processed VID 0 to RID 0");
+
+        return SAI_NULL_OBJECT_ID;
+    }
+
+    auto it = g_translated.find(vid);
+
+    if (it != g_translated.end())
+    {
+        // this object was already processed,
+        // just return real object id
+
+        SWSS_LOG_DEBUG("processed VID %llx to RID %llx", vid, it->second);
+
+        return it->second;
+    }
+
+    VidRecreateContext ctx = prepareSingleVid(vid);
+
+    executeSingleVid(ctx);
 
-    g_translated[vid] = rid;
+    recordSingleVid(ctx);
 
-    return rid;
+    return ctx.rid;
 }
 
 sai_attr_serialization_type_t getSerializationType(sai_object_type_t objectType, sai_attr_id_t attrId)
@@ -382,6 +485,62 @@ sai_attr_serialization_type_t getSerializationType(sai_object_type_t objectType,
     return serializationType;
 }
 
+bool getObjectIdsFromAttribute(
+        _In_ sai_object_type_t objectType,
+        _In_ sai_attribute_t &attr,
+        _Out_ uint32_t &count,
+        _Out_ sai_object_id_t *&objectIdList)
+{
+    SWSS_LOG_ENTER();
+
+    sai_attr_serialization_type_t serializationType = getSerializationType(objectType, attr.id);
+
+    switch (serializationType)
+    {
+        case SAI_SERIALIZATION_TYPE_OBJECT_ID:
+            count = 1;
+            objectIdList = &attr.value.oid;
+            break;
+
+        case SAI_SERIALIZATION_TYPE_OBJECT_LIST:
+            count = attr.value.objlist.count;
+            objectIdList = attr.value.objlist.list;
+            break;
+
+        case SAI_SERIALIZATION_TYPE_ACL_FIELD_DATA_OBJECT_ID:
+            count = 1;
+            objectIdList = &attr.value.aclfield.data.oid;
+            break;
+
+        case SAI_SERIALIZATION_TYPE_ACL_FIELD_DATA_OBJECT_LIST:
+            count = attr.value.aclfield.data.objlist.count;
+            objectIdList = attr.value.aclfield.data.objlist.list;
+            break;
+
+        case SAI_SERIALIZATION_TYPE_ACL_ACTION_DATA_OBJECT_ID:
+            count = 1;
+            objectIdList = &attr.value.aclaction.parameter.oid;
+            break;
+
+        case SAI_SERIALIZATION_TYPE_ACL_ACTION_DATA_OBJECT_LIST:
+            count = attr.value.aclaction.parameter.objlist.count;
+            objectIdList = attr.value.aclaction.parameter.objlist.list;
+            break;
+
+        case SAI_SERIALIZATION_TYPE_PORT_BREAKOUT:
+            count = attr.value.portbreakout.port_list.count;
+            objectIdList = attr.value.portbreakout.port_list.list;
+            break;
+
+        default:
+            count = 0;
+            objectIdList = NULL;
+            return false;
+    }
+
+    return true;
+}
+
 void processAttributesForOids(sai_object_type_t objectType, std::shared_ptr<SaiAttributeList> list)
 {
     SWSS_LOG_ENTER();
@@ -394,52 +553,12 @@ void processAttributesForOids(sai_object_type_t objectType, std::shared_ptr<SaiA
 
     for (uint32_t idx = 0; idx < attrCount; idx++)
     {
-        sai_attribute_t &attr = attrList[idx];
-
-        sai_attr_serialization_type_t serializationType = getSerializationType(objectType, attr.id);
-
-        uint32_t count = 0;
+        uint32_t count;
         sai_object_id_t *objectIdList;
 
-        switch (serializationType)
+        if (!getObjectIdsFromAttribute(objectType, attrList[idx], count, objectIdList))
         {
-            case SAI_SERIALIZATION_TYPE_OBJECT_ID:
-                count = 1;
-                objectIdList = &attr.value.oid;
-                break;
-
-            case SAI_SERIALIZATION_TYPE_OBJECT_LIST:
-                count = attr.value.objlist.count;
-                objectIdList = attr.value.objlist.list;
-                break;
-
-            case SAI_SERIALIZATION_TYPE_ACL_FIELD_DATA_OBJECT_ID:
-                count = 1;
-                objectIdList = &attr.value.aclfield.data.oid;
-                break;
-
-            case SAI_SERIALIZATION_TYPE_ACL_FIELD_DATA_OBJECT_LIST:
-                count = attr.value.aclfield.data.objlist.count;
-                objectIdList = attr.value.aclfield.data.objlist.list;
-                break;
-
-            case SAI_SERIALIZATION_TYPE_ACL_ACTION_DATA_OBJECT_ID:
-                count = 1;
-                objectIdList = &attr.value.aclaction.parameter.oid;
-                break;
-
-            case SAI_SERIALIZATION_TYPE_ACL_ACTION_DATA_OBJECT_LIST:
-                count = attr.value.aclaction.parameter.objlist.count;
-                objectIdList = attr.value.aclaction.parameter.objlist.list;
-                break;
-
-            case SAI_SERIALIZATION_TYPE_PORT_BREAKOUT:
-                count = attr.value.portbreakout.port_list.count;
-                objectIdList = attr.value.portbreakout.port_list.list;
-                break;
-
-            default:
-                continue;
+            continue;
         }
 
         // attribute contains object id's, they need to be translated
@@ -467,15 +586,232 @@ sai_object_id_t getObjectIdFromString(const std::string &strObjectId)
     return objectId;
 }
 
-void processOids()
+typedef std::vector<std::vector<sai_object_id_t>> OidLevels;
+
+/*
+ * Builds dependency graph of not yet translated OIDs using OID attributes
+ * and orders it into levels (Kahn's algorithm). Objects in level N depend
+ * only on objects from levels lower than N, so objects in the same level
+ * are independent of each other.
+ */
+OidLevels buildOidLevels()
 {
+    SWSS_LOG_ENTER();
+
+    std::unordered_set<sai_object_id_t> nodes;
+
     for (auto &kv: g_oids)
     {
-        const std::string &strObjectId = kv.first;
+        sai_object_id_t vid = getObjectIdFromString(kv.first);
+
+        if (g_translated.find(vid) == g_translated.end())
+        {
+            nodes.insert(vid);
+        }
+    }
+
+    std::unordered_map<sai_object_id_t, size_t> pending;
+    std::unordered_map<sai_object_id_t, std::vector<sai_object_id_t>> dependents;
+
+    for (sai_object_id_t vid: nodes)
+    {
+        std::string strVid;
+        sai_serialize_primitive(vid, strVid);
+
+        sai_object_type_t objectType = getObjectTypeFromVid(vid);
+
+        std::shared_ptr<SaiAttributeList> list = g_attributesLists[g_oids[strVid]];
+
+        sai_attribute_t *attrList = list->get_attr_list();
+
+        uint32_t attrCount = list->get_attr_count();
+
+        std::unordered_set<sai_object_id_t> deps;
+
+        for (uint32_t idx = 0; idx < attrCount; idx++)
+        {
+            uint32_t count;
+            sai_object_id_t *objectIdList;
+
+            if (!getObjectIdsFromAttribute(objectType, attrList[idx], count, objectIdList))
+            {
+                continue;
+            }
+
+            for (uint32_t i = 0; i < count; i++)
+            {
+                sai_object_id_t dep = objectIdList[i];
+
+                // missing dependencies will be reported when object is
+                // processed, same as in recursive processing
+
+                if (dep != vid && nodes.find(dep) != nodes.end())
+                {
+                    deps.insert(dep);
+                }
+            }
+        }
+
+        pending[vid] = deps.size();
+
+        for (sai_object_id_t dep: deps)
+        {
+            dependents[dep].push_back(vid);
+        }
+    }
+
+    OidLevels levels;
+
+    std::vector<sai_object_id_t> current;
+
+    for (auto &kv: pending)
+    {
+        if (kv.second == 0)
+        {
+            current.push_back(kv.first);
+        }
+    }
+
+    size_t ordered = 0;
+
+    while (current.size())
+    {
+        std::vector<sai_object_id_t> next;
+
+        for (sai_object_id_t vid: current)
+        {
+            for (sai_object_id_t dependent: dependents[vid])
+            {
+                if (--pending[dependent] == 0)
+                {
+                    next.push_back(dependent);
+                }
+            }
+        }
+
+        ordered += current.size();
+
+        levels.push_back(std::move(current));
+
+        current = std::move(next);
+    }
+
+    if (ordered != nodes.size())
+    {
+        SWSS_LOG_ERROR("dependency cycle detected, %zu of %zu objects can't be ordered", nodes.size() - ordered, nodes.size());
+
+        for (auto &kv: pending)
+        {
+            if (kv.second != 0)
+            {
+                SWSS_LOG_ERROR("VID %llx is part of or depends on cycle", kv.first);
+            }
+        }
+
+        exit(EXIT_FAILURE);
+    }
+
+    return levels;
+}
+
+void executeLevel(
+        _In_ std::vector<VidRecreateContext> &contexts,
+        _In_ size_t threads)
+{
+    SWSS_LOG_ENTER();
+
+    threads = std::min(threads, contexts.size());
+
+    if (threads <= 1)
+    {
+        for (auto &ctx: contexts)
+        {
+            executeSingleVid(ctx);
+        }
+
+        return;
+    }
+
+    std::atomic<size_t> index(0);
+
+    std::vector<std::thread> workers;
+
+    for (size_t i = 0; i < threads; i++)
+    {
+        workers.push_back(std::thread([&]() {
+
+            for (size_t idx = index++; idx < contexts.size(); idx = index++)
+            {
+                executeSingleVid(contexts[idx]);
+            }
+        }));
+    }
+
+    for (auto &worker: workers)
+    {
+        worker.join();
+    }
+}
+
+size_t getHardReinitThreads()
+{
+    SWSS_LOG_ENTER();
+
+    const char *value = profile_get_value(0, SYNCD_KEY_HARD_REINIT_THREADS);
+
+    if (value == NULL)
+    {
+        return 1;
+    }
+
+    int threads = atoi(value);
+
+    if (threads < 1)
+    {
+        SWSS_LOG_WARN("invalid %s value: %s, using 1", SYNCD_KEY_HARD_REINIT_THREADS, value);
+
+        return 1;
+    }
+
+    return (size_t)threads;
+}
+
+void processOids()
+{
+    SWSS_LOG_ENTER();
+
+    OidLevels levels = buildOidLevels();
+
+    size_t threads = getHardReinitThreads();
+
+    SWSS_LOG_NOTICE("recreating OIDs in %zu levels using %zu threads", levels.size(), threads);
+
+    for (size_t level = 0; level < levels.size(); level++)
+    {
+        auto levelStart = std::chrono::steady_clock::now();
+
+        std::vector<VidRecreateContext> contexts;
+
+        contexts.reserve(levels[level].size());
+
+        // all dependencies are already translated, so prepare
+        // will not recurse, it will only replace VIDs with RIDs
+
+        for (sai_object_id_t vid: levels[level])
+        {
+            contexts.push_back(prepareSingleVid(vid));
+        }
+
+        executeLevel(contexts, threads);
+
+        for (const auto &ctx: contexts)
+        {
+            recordSingleVid(ctx);
+        }
 
-        sai_object_id_t vidObjectId = getObjectIdFromString(strObjectId);
+        auto time = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - levelStart);
 
-        processSingleVid(vidObjectId);
+        SWSS_LOG_NOTICE("level %zu: processed %zu objects in %ld ms", level, contexts.size(), (long)time.count());
     }
 }
 
@@ -79,12 +79,11 @@ void redisPutFdbEntryToAsicView(
 
     std::string key = "ASIC_STATE:" + strObjectType + ":" + strFdbEntry;
 
+    std::unordered_map<std::string, std::string> hash;
+
     for (const auto &e: entry)
     {
-        const std::string &strField = fvField(e);
-        const std::string &strValue = fvValue(e);
-
-        g_redisClient->hset(key, strField, strValue);
+        hash[fvField(e)] = fvValue(e);
     }
 
     // currently we need to add type manually since fdb event don't contain type
@@ -107,7 +106,11 @@ void redisPutFdbEntryToAsicView(
     std::string strAttrType;
     sai_serialize_primitive(attr.id, strAttrType);
 
-    g_redisClient->hset(key, strAttrType, strAttrValue);
+    hash[strAttrType] = strAttrValue;
+
+    // all attributes are put in single command
+
+    g_redisClient->hmset(key, hash);
 }
 
 void on_fdb_event(
@@ -165,6 +168,8 @@ void on_fdb_event(
         redisPutFdbEntryToAsicView(&copy.fdb_entry, list);
     }
 
+    vidRidCacheFlush();
+
     send_notification("fdb_event", s);
 }
 
@@ -185,6 +190,8 @@ void on_port_state_change(
     {
         sai_port_oper_status_notification_t *oper_stat = &data[i];
 
+        updatePortCountersOperStatus(oper_stat->port_id, oper_stat->port_state);
+
         // NOTE: make a copy to not modify sdk values
         sai_port_oper_status_notification_t copy;
 
@@ -195,6 +202,8 @@ void on_port_state_change(
         sai_serialize_primitive(copy, s);
     }
 
+    vidRidCacheFlush();
+
     send_notification("port_state_change", s);
 }
 
@@ -213,6 +222,9 @@ void on_port_event(
     {
         sai_port_event_notification_t *port_event = &data[i];
 
+        // RID of removed port can be reused by new one
+        invalidatePortCountersCapabilities(port_event->port_id);
+
         // NOTE: make a copy to not modify sdk values
         sai_port_event_notification_t copy;
 
@@ -223,6 +235,11 @@ void on_port_event(
         sai_serialize_primitive(copy, s);
     }
 
+    vidRidCacheFlush();
+
+    // port was added or removed
+    saiInvalidatePortList();
+
     send_notification("port_event", s);
 }
 
@@ -271,6 +288,8 @@ void on_packet_event(
             copy.get_attr_list(),
             false);
 
+    vidRidCacheFlush();
+
     send_notification("packet_event", s, entry);
 }
 
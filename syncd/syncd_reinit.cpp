@@ -1,6 +1,7 @@
 #include <string>
 #include <vector>
 #include <unordered_map>
+#include <unordered_set>
 
 #include "syncd.h"
 
@@ -48,7 +49,16 @@ sai_object_id_t saiGetCpuId()
     return attr.value.oid;
 }
 
-std::vector<sai_object_id_t> saiGetPortList()
+/*
+ * Port list is cached, since it changes only on port events, cache is
+ * filled on syncd start and invalidated by saiInvalidatePortList.
+ *
+ * Cache must be accessed under g_mutex.
+ */
+static std::vector<sai_object_id_t> g_portListCache;
+static bool g_portListCacheValid = false;
+
+std::vector<sai_object_id_t> saiQueryPortList()
 {
     SWSS_LOG_ENTER();
 
@@ -73,16 +83,43 @@ std::vector<sai_object_id_t> saiGetPortList()
         exit(EXIT_FAILURE);
     }
 
+    portList.resize(attr.value.objlist.count);
+
     return portList;
 }
 
+const std::vector<sai_object_id_t>& saiGetPortList()
+{
+    SWSS_LOG_ENTER();
+
+    if (!g_portListCacheValid)
+    {
+        g_portListCache = saiQueryPortList();
+
+        g_portListCacheValid = true;
+
+        SWSS_LOG_INFO("port list cache filled, ports: %zu", g_portListCache.size());
+    }
+
+    return g_portListCache;
+}
+
+void saiInvalidatePortList()
+{
+    SWSS_LOG_ENTER();
+
+    g_portListCacheValid = false;
+
+    invalidatePortCountersSnapshot();
+}
+
 std::unordered_map<sai_uint32_t, sai_object_id_t> saiGetHardwareLaneMap()
 {
     SWSS_LOG_ENTER();
 
     std::unordered_map<sai_uint32_t, sai_object_id_t> map;
 
-    const std::vector<sai_object_id_t> portList = saiGetPortList();
+    const std::vector<sai_object_id_t> &portList = saiGetPortList();
 
     // NOTE: currently we don't support port breakout
     // this will need to be addressed in future
@@ -179,7 +216,7 @@ void redisSaveLaneMap(const std::unordered_map<sai_uint32_t, sai_object_id_t> &m
 {
     SWSS_LOG_ENTER();
 
-    redisClearLaneMap();
+    std::unordered_map<std::string, std::string> hash;
 
     for (auto const &it: map)
     {
@@ -192,16 +229,46 @@ void redisSaveLaneMap(const std::unordered_map<sai_uint32_t, sai_object_id_t> &m
         sai_serialize_primitive(lane, strLane);
         sai_serialize_primitive(portId, strPortId);
 
-        // TODO use multi or hmset
-        g_redisClient->hset(LANES, strLane, strPortId);
+        hash[strLane] = strPortId;
     }
+
+    // clear and save in single round trip
+
+    swss::RedisPipeline pipeline(g_redisClient);
+
+    pipeline.del(LANES);
+
+    if (hash.size())
+    {
+        pipeline.hmset(LANES, hash);
+    }
+
+    pipeline.flush();
 }
 
 std::vector<std::string> redisGetAsicStateKeys()
 {
     SWSS_LOG_ENTER();
 
-    return g_redisClient->keys("ASIC_STATE:*");
+    // SCAN is used instead of KEYS to not block redis for the whole key
+    // space, and since SCAN can return same key twice, keys are deduplicated
+
+    std::unordered_set<std::string> seen;
+
+    std::vector<std::string> asicStateKeys;
+
+    g_redisClient->scanKeys(ASIC_STATE_PATTERN, ASIC_STATE_SCAN_COUNT, [&](const std::vector<std::string> &keys) {
+
+        for (const auto &key: keys)
+        {
+            if (seen.insert(key).second)
+            {
+                asicStateKeys.push_back(key);
+            }
+        }
+    });
+
+    return asicStateKeys;
 }
 
 void redisClearVidToRidMap()
@@ -360,13 +427,7 @@ void redisCreateRidAndVidMapping(sai_object_id_t rid, sai_object_id_t vid)
 {
     SWSS_LOG_ENTER();
 
-    std::string strRid, strVid;
-
-    sai_serialize_primitive(rid, strRid);
-    sai_serialize_primitive(vid, strVid);
-
-    g_redisClient->hset(VIDTORID, strVid, strRid);
-    g_redisClient->hset(RIDTOVID, strRid, strVid);
+    vidRidCacheInsert(vid, rid);
 
     SWSS_LOG_DEBUG("set VID %llx and RID %llx", vid, rid);
 }
@@ -543,6 +604,14 @@ void onSyncdStart(bool warmStart)
 
     SWSS_LOG_ENTER();
 
+    // switch was just initialized, port list could change
+
+    saiInvalidatePortList();
+
+    invalidatePortCountersCapabilities(SAI_NULL_OBJECT_ID);
+
+    saiGetPortList();
+
     helperCheckLaneMap();
 
     helperCheckCpuId();
@@ -553,6 +622,10 @@ void onSyncdStart(bool warmStart)
 
     helperCheckPortIds();
 
+    // hard reinit reads VIDTORID and RIDTOVID directly from redis
+
+    vidRidCacheFlush();
+
     if (warmStart)
     {
         SWSS_LOG_NOTICE("skipping hard reinit since WARM start was performed");
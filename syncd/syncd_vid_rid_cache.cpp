@@ -0,0 +1,270 @@
+#include "syncd.h"
+
+#include <unordered_set>
+#include <atomic>
+
+/*
+ * In memory copy of VIDTORID and RIDTOVID maps.
+ *
+ * Syncd is the only writer of those maps, so after loading them once on
+ * start, local copy is authoritative and translations don't need to touch
+ * redis. Changes are written back to redis in batches by vidRidCacheFlush.
+ *
+ * All functions here must be called under g_mutex.
+ */
+
+struct PendingHashChanges
+{
+    std::unordered_map<std::string, std::string> sets;
+    std::unordered_set<std::string> dels;
+
+    void set(
+            _In_ const std::string &field,
+            _In_ const std::string &value)
+    {
+        dels.erase(field);
+        sets[field] = value;
+    }
+
+    void del(
+            _In_ const std::string &field)
+    {
+        sets.erase(field);
+        dels.insert(field);
+    }
+
+    bool empty() const
+    {
+        return sets.empty() && dels.empty();
+    }
+
+    void clear()
+    {
+        sets.clear();
+        dels.clear();
+    }
+
+    void flush(
+            _In_ swss::RedisPipeline &pipeline,
+            _In_ const std::string &hash)
+    {
+        // each field is either in sets or in dels, so order of those
+        // two operations don't change final state of hash
+
+        if (dels.size())
+        {
+            std::vector<std::string> fields(dels.begin(), dels.end());
+
+            pipeline.hdel(hash, fields);
+        }
+
+        if (sets.size())
+        {
+            pipeline.hmset(hash, sets);
+        }
+
+        clear();
+    }
+};
+
+/*
+ * Generation of each object type is incremented when object of that type
+ * is added or removed, so other threads (like counters) can detect changes
+ * without taking g_mutex.
+ */
+static std::atomic<uint64_t> g_objectTypeGeneration[SAI_OBJECT_TYPE_MAX];
+
+static void vidRidCacheBumpGeneration(
+        _In_ sai_object_id_t vid)
+{
+    sai_object_type_t objectType = (sai_object_type_t)(vid >> 48);
+
+    if (objectType < SAI_OBJECT_TYPE_MAX)
+    {
+        g_objectTypeGeneration[objectType]++;
+    }
+}
+
+static void vidRidCacheBumpAllGenerations()
+{
+    for (int idx = 0; idx < SAI_OBJECT_TYPE_MAX; idx++)
+    {
+        g_objectTypeGeneration[idx]++;
+    }
+}
+
+std::unordered_map<sai_object_id_t, sai_object_id_t> g_vidToRidCache;
+std::unordered_map<sai_object_id_t, sai_object_id_t> g_ridToVidCache;
+
+PendingHashChanges g_pendingVidToRid;
+PendingHashChanges g_pendingRidToVid;
+
+void vidRidCacheLoad()
+{
+    SWSS_LOG_ENTER();
+
+    g_vidToRidCache = redisGetVidToRidMap();
+    g_ridToVidCache = redisGetRidToVidMap();
+
+    g_pendingVidToRid.clear();
+    g_pendingRidToVid.clear();
+
+    vidRidCacheBumpAllGenerations();
+
+    SWSS_LOG_NOTICE("loaded %zu VID to RID and %zu RID to VID entries",
+            g_vidToRidCache.size(),
+            g_ridToVidCache.size());
+}
+
+void vidRidCacheReset(
+        _In_ const std::unordered_map<sai_object_id_t, sai_object_id_t> &vidToRidMap)
+{
+    SWSS_LOG_ENTER();
+
+    // caller is responsible for putting same map to redis
+
+    g_vidToRidCache = vidToRidMap;
+    g_ridToVidCache.clear();
+
+    for (const auto &kv: vidToRidMap)
+    {
+        g_ridToVidCache[kv.second] = kv.first;
+    }
+
+    g_pendingVidToRid.clear();
+    g_pendingRidToVid.clear();
+
+    vidRidCacheBumpAllGenerations();
+}
+
+bool vidRidCacheGetRid(
+        _In_ sai_object_id_t vid,
+        _Out_ sai_object_id_t &rid)
+{
+    auto it = g_vidToRidCache.find(vid);
+
+    if (it == g_vidToRidCache.end())
+        return false;
+
+    rid = it->second;
+
+    return true;
+}
+
+bool vidRidCacheGetVid(
+        _In_ sai_object_id_t rid,
+        _Out_ sai_object_id_t &vid)
+{
+    auto it = g_ridToVidCache.find(rid);
+
+    if (it == g_ridToVidCache.end())
+        return false;
+
+    vid = it->second;
+
+    return true;
+}
+
+void vidRidCacheInsert(
+        _In_ sai_object_id_t vid,
+        _In_ sai_object_id_t rid)
+{
+    SWSS_LOG_ENTER();
+
+    g_vidToRidCache[vid] = rid;
+    g_ridToVidCache[rid] = vid;
+
+    std::string strVid;
+    std::string strRid;
+
+    sai_serialize_primitive(vid, strVid);
+    sai_serialize_primitive(rid, strRid);
+
+    g_pendingVidToRid.set(strVid, strRid);
+    g_pendingRidToVid.set(strRid, strVid);
+
+    vidRidCacheBumpGeneration(vid);
+}
+
+void vidRidCacheRemove(
+        _In_ sai_object_id_t vid,
+        _In_ sai_object_id_t rid)
+{
+    SWSS_LOG_ENTER();
+
+    g_vidToRidCache.erase(vid);
+
+    auto it = g_ridToVidCache.find(rid);
+
+    // RID could be already reused by other VID, don't remove that mapping
+
+    if (it != g_ridToVidCache.end() && it->second == vid)
+    {
+        g_ridToVidCache.erase(it);
+    }
+
+    std::string strVid;
+    std::string strRid;
+
+    sai_serialize_primitive(vid, strVid);
+    sai_serialize_primitive(rid, strRid);
+
+    g_pendingVidToRid.del(strVid);
+
+    if (g_ridToVidCache.find(rid) == g_ridToVidCache.end())
+    {
+        g_pendingRidToVid.del(strRid);
+    }
+
+    vidRidCacheBumpGeneration(vid);
+}
+
+uint64_t vidRidCacheGetGeneration(
+        _In_ sai_object_type_t objectType)
+{
+    // can be called without g_mutex
+
+    if (objectType >= SAI_OBJECT_TYPE_MAX)
+        return 0;
+
+    return g_objectTypeGeneration[objectType];
+}
+
+std::vector<std::pair<sai_object_id_t, sai_object_id_t>> vidRidCacheGetObjects(
+        _In_ sai_object_type_t objectType)
+{
+    SWSS_LOG_ENTER();
+
+    std::vector<std::pair<sai_object_id_t, sai_object_id_t>> objects;
+
+    for (const auto &kv: g_vidToRidCache)
+    {
+        if ((sai_object_type_t)(kv.first >> 48) == objectType)
+        {
+            objects.push_back(kv);
+        }
+    }
+
+    return objects;
+}
+
+void vidRidCacheFlush()
+{
+    SWSS_LOG_ENTER();
+
+    if (g_pendingVidToRid.empty() && g_pendingRidToVid.empty())
+        return;
+
+    SWSS_LOG_DEBUG("flushing VID to RID changes: %zu set %zu del",
+            g_pendingVidToRid.sets.size(),
+            g_pendingVidToRid.dels.size());
+
+    // both maps are written in single round trip
+
+    swss::RedisPipeline pipeline(g_redisClient);
+
+    g_pendingVidToRid.flush(pipeline, VIDTORID);
+    g_pendingRidToVid.flush(pipeline, RIDTOVID);
+
+    pipeline.flush();
+}